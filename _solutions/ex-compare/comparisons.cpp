@@ -1,14 +1,17 @@
 #include <catch2/catch_test_macros.hpp>
+#include <compiled_format.hpp>
+#include <cstdio>
 #include <iostream>
 #include <vector>
 #include <string>
-#include <format>
 
 using namespace std::literals;
 
-void print(std::string_view format_sv, const auto&... args)
+// format string parsed at compile time - see helpers/compiled_format.hpp
+template <helpers::FixedString Fmt>
+void print(const auto&... args)
 {
-    std::cout << std::vformat(format_sv, std::make_format_args(args...)) << "\n";
+    helpers::fmt_string<Fmt>::print(stdout, args...);
 }
 
 struct Rating
@@ -17,13 +20,13 @@ struct Rating
 
     bool operator==(const Rating& other) const
     {
-        std::cout << std::format("Rating({}).op==({})\n", value, other.value);
+        print<"Rating({}).op==({})">(value, other.value);
         return value == other.value;
     }
 
     bool operator<(const Rating& other) const
     {
-        std::cout << std::format("Rating({}).op<({})\n", value, other.value);
+        print<"Rating({}).op<({})">(value, other.value);
         return value < other.value;
     }
 };
@@ -35,7 +38,7 @@ struct Gadget
 
     std::strong_ordering operator<=>(const Gadget& other) const
     {
-        std::cout << std::format("Gadget({}, {}).op<=>(Gadget({}, {}))\n", name, price, other.name, other.price);
+        print<"Gadget({}, {}).op<=>(Gadget({}, {}))">(name, price, other.name, other.price);
 
         if (auto cmp_result = name <=> other.name; cmp_result != 0)
             return cmp_result;
@@ -0,0 +1,98 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    struct Gadget
+    {
+        std::string name;
+        int id;
+        double price;
+
+        auto operator<=>(const Gadget&) const = default;
+    };
+
+    // pre-C++20 style - every member is compared twice in the worst case (a < b, then b < a)
+    struct LegacyGadget
+    {
+        std::string name;
+        int id;
+        double price;
+
+        bool operator<(const LegacyGadget& other) const
+        {
+            return std::tie(name, id, price) < std::tie(other.name, other.id, other.price);
+        }
+    };
+
+    template <typename TGadget>
+    std::vector<TGadget> create_gadgets(size_t count)
+    {
+        helpers::random::PCG rnd{42};
+
+        std::vector<TGadget> gadgets;
+        gadgets.reserve(count);
+        for (size_t i = 0; i < count; ++i) // few names - most comparisons go past the first member
+            gadgets.push_back({"gadget-" + std::to_string(rnd() % 16), static_cast<int>(rnd() % 1000), (rnd() % 100'000) / 100.0});
+        return gadgets;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("compare - sort 100k gadgets by name, id, price")
+{
+    constexpr size_t count = 100'000;
+
+    const auto gadgets = create_gadgets<Gadget>(count);
+    const auto legacy_gadgets = create_gadgets<LegacyGadget>(count);
+
+    std::vector<Gadget> data;
+    bench.run("defaulted operator<=>", [&] {
+        data = gadgets;
+        std::sort(data.begin(), data.end());
+        do_not_optimize(data.data());
+    });
+
+    std::vector<LegacyGadget> legacy_data;
+    bench.run("std::tie in operator<", [&] {
+        legacy_data = legacy_gadgets;
+        std::sort(legacy_data.begin(), legacy_data.end()); // not totally_ordered - no std::ranges::sort
+        do_not_optimize(legacy_data.data());
+    });
+}
+
+HELPERS_BENCHMARK("compare - 1M mixed-sign comparisons")
+{
+    constexpr size_t count = 1'000'000;
+
+    helpers::random::PCG rnd{665};
+    std::vector<int> signed_values(count);
+    std::vector<unsigned> unsigned_values(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        signed_values[i] = static_cast<int>(rnd()); // half of them negative
+        unsigned_values[i] = rnd();
+    }
+
+    bench.run("std::cmp_less(int, unsigned)", [&] {
+        size_t less = 0;
+        for (size_t i = 0; i < count; ++i)
+            less += std::cmp_less(signed_values[i], unsigned_values[i]);
+        do_not_optimize(less);
+    });
+
+    bench.run("int64 promotion", [&] {
+        size_t less = 0;
+        for (size_t i = 0; i < count; ++i)
+            less += static_cast<long long>(signed_values[i]) < static_cast<long long>(unsigned_values[i]);
+        do_not_optimize(less);
+    });
+}
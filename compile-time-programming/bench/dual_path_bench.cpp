@@ -0,0 +1,29 @@
+#include <benchmark.hpp>
+#include <datasets.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "dual_path.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+HELPERS_BENCHMARK("dual path - 1M elements")
+{
+    const auto ints = helpers::create_dataset(helpers::Distribution::uniform, 1 << 20, 42, {.low = 0, .high = 1 << 20});
+    const std::vector<uint8_t> bytes(ints.begin(), ints.end());
+
+    bench.run("count int - std::count", [&] { do_not_optimize(std::count(ints.begin(), ints.end(), 42)); });
+    bench.run("count int - dual_path::count", [&] { do_not_optimize(dual_path::count(ints, 42)); });
+
+    bench.run("count byte - std::count", [&] { do_not_optimize(std::count(bytes.begin(), bytes.end(), uint8_t{42})); });
+    bench.run("count byte - dual_path::count", [&] { do_not_optimize(dual_path::count(bytes, 42)); });
+
+    bench.run("find int (missing) - std::find", [&] { do_not_optimize(std::find(ints.begin(), ints.end(), -1)); });
+    bench.run("find int (missing) - dual_path::find", [&] { do_not_optimize(dual_path::find(ints, -1)); });
+
+    auto copy_of_ints = ints;
+    bench.run("equal int - std::equal", [&] { do_not_optimize(std::equal(ints.begin(), ints.end(), copy_of_ints.begin())); });
+    bench.run("equal int - dual_path::equal", [&] { do_not_optimize(dual_path::equal(ints, copy_of_ints)); });
+}
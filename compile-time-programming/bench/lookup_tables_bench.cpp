@@ -0,0 +1,92 @@
+#include <benchmark.hpp>
+#include <datasets.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "lookup_tables.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr size_t buffer_size = 1 << 20;
+
+    std::vector<uint8_t> random_bytes()
+    {
+        helpers::random::PCGBatch<> rnd{42};
+        std::vector<uint32_t> words(buffer_size / 4);
+        rnd.fill(words);
+
+        std::vector<uint8_t> bytes(buffer_size);
+        std::memcpy(bytes.data(), words.data(), bytes.size());
+        return bytes;
+    }
+
+    uint32_t crc32_bitwise(std::span<const uint8_t> data)
+    {
+        uint32_t crc = ~0u;
+        for (uint8_t byte : data)
+        {
+            crc ^= byte;
+            for (int bit = 0; bit < 8; ++bit)
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        return ~crc;
+    }
+
+    uint8_t hex_digit_branchy(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return lut::invalid;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("lookup tables - 1 MiB")
+{
+    const auto bytes = random_bytes();
+
+    bench.run("crc32 - bitwise", [&] { do_not_optimize(crc32_bitwise(bytes)); });
+    bench.run("crc32 - table", [&] { do_not_optimize(lut::crc32(bytes)); });
+
+    bench.run("popcount - std::popcount", [&] {
+        size_t count = 0;
+        for (uint8_t byte : bytes)
+            count += std::popcount(byte);
+        do_not_optimize(count);
+    });
+    bench.run("popcount - table", [&] { do_not_optimize(lut::popcount(bytes)); });
+
+    std::string text(bytes.begin(), bytes.end());
+    bench.run("case fold - std::tolower", [&] {
+        std::ranges::transform(text, text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        do_not_optimize(text.data());
+    });
+    bench.run("case fold - table", [&] {
+        lut::to_lower(text);
+        do_not_optimize(text.data());
+    });
+
+    std::string hex(buffer_size, '0');
+    helpers::random::PCG rnd{42};
+    helpers::generate_random_string(hex, rnd, "0123456789abcdefABCDEF");
+    std::vector<uint8_t> decoded(hex.size() / 2);
+    bench.run("hex decode - branchy", [&] {
+        for (size_t i = 0; i < decoded.size(); ++i)
+            decoded[i] = static_cast<uint8_t>((hex_digit_branchy(hex[2 * i]) << 4) | hex_digit_branchy(hex[2 * i + 1]));
+        do_not_optimize(decoded.data());
+    });
+    bench.run("hex decode - table", [&] {
+        do_not_optimize(lut::hex_decode(hex, decoded));
+    });
+}
@@ -0,0 +1,31 @@
+#include <benchmark.hpp>
+#include <datasets.hpp>
+
+#include <algorithm>
+#include <format>
+#include <vector>
+
+#include "unique_average.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+HELPERS_BENCHMARK("avg for unique - 2 x 1M x int")
+{
+    for (auto distribution : {helpers::Distribution::uniform, helpers::Distribution::sorted, helpers::Distribution::few_unique})
+    {
+        const helpers::DatasetOptions options{.low = -10'000'000, .high = 10'000'000, .unique_values = 1000};
+
+        auto data1 = helpers::create_dataset(distribution, 1'000'000, 42, options);
+        auto data2 = helpers::create_dataset(distribution, 1'000'000, 665, options);
+
+        const auto name = helpers::to_string(distribution);
+
+        bench.run(std::format("sort + unique - {}", name), [&] { do_not_optimize(avg_for_unique(data1, data2)); });
+        bench.run(std::format("hashed - {}", name), [&] { do_not_optimize(avg_for_unique_hashed(data1, data2)); });
+        bench.run(std::format("parallel - {}", name), [&] { do_not_optimize(avg_for_unique_parallel(data1, data2)); });
+
+        std::ranges::sort(data1);
+        std::ranges::sort(data2);
+        bench.run(std::format("sorted merge - {}", name), [&] { do_not_optimize(avg_for_unique_sorted(data1, data2)); });
+    }
+}
@@ -6,6 +6,8 @@
 #include <helpers.hpp>
 #include <array>
 
+#include "unique_average.hpp"
+
 using namespace std::literals;
 
 int runtime_func(int x)
@@ -107,28 +109,6 @@ constexpr auto create_powers()
     return powers;
 }
 
-template <std::ranges::input_range... TRng_>
-constexpr auto avg_for_unique(const TRng_&... rng)
-{
-    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
-
-    std::vector<TElement> vec;                            // empty vector
-    vec.reserve((rng.size() + ...));                      // reserve a buffer - fold expression C++17
-    (vec.insert(vec.end(), rng.begin(), rng.end()), ...); // fold expression C++17
-
-    // sort items
-    std::ranges::sort(vec); // std::sort(vec.begin(), vec.end());
-
-    // create span of unique_items
-    auto new_end = std::unique(vec.begin(), vec.end());
-    std::span unique_items{vec.begin(), new_end};
-
-    // calculate sum of unique items
-    auto sum = std::accumulate(unique_items.begin(), unique_items.end(), TElement{});
-
-    return sum / static_cast<double>(unique_items.size());
-}
-
 TEST_CASE("avg for unique")
 {
     constexpr std::array lst1 = {1, 2, 3, 4, 5};
@@ -0,0 +1,354 @@
+#ifndef DUAL_PATH_HPP
+#define DUAL_PATH_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DUAL_PATH_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+// Generalization of len() from compile_time_programming.cpp: every primitive has a constexpr-safe scalar path
+// used during constant evaluation and a runtime path - libc (already vectorized) or SIMD kernels chosen
+// once at startup from the CPU features.
+namespace dual_path
+{
+    struct CpuFeatures
+    {
+        bool sse2 = false;
+        bool avx2 = false;
+    };
+
+    inline CpuFeatures detect_cpu_features()
+    {
+        CpuFeatures features;
+#ifdef DUAL_PATH_X86_KERNELS
+        __builtin_cpu_init();
+        features.sse2 = __builtin_cpu_supports("sse2");
+        features.avx2 = __builtin_cpu_supports("avx2");
+#endif
+        return features;
+    }
+
+    namespace kernels
+    {
+        inline size_t count_u8_scalar(const std::uint8_t* data, size_t size, std::uint8_t value)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                count += data[i] == value;
+            return count;
+        }
+
+        inline size_t count_u32_scalar(const std::uint32_t* data, size_t size, std::uint32_t value)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                count += data[i] == value;
+            return count;
+        }
+
+        inline const std::uint32_t* find_u32_scalar(const std::uint32_t* data, size_t size, std::uint32_t value)
+        {
+            return std::find(data, data + size, value);
+        }
+
+#ifdef DUAL_PATH_X86_KERNELS
+        __attribute__((target("avx2"))) inline size_t count_u8_avx2(const std::uint8_t* data, size_t size, std::uint8_t value)
+        {
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+                count += std::popcount(mask);
+            }
+
+            return count + count_u8_scalar(data + i, size - i, value);
+        }
+
+        __attribute__((target("avx2"))) inline size_t count_u32_avx2(const std::uint32_t* data, size_t size, std::uint32_t value)
+        {
+            const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const auto mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, needle))));
+                count += std::popcount(mask);
+            }
+
+            return count + count_u32_scalar(data + i, size - i, value);
+        }
+
+        __attribute__((target("avx2"))) inline const std::uint32_t* find_u32_avx2(const std::uint32_t* data, size_t size, std::uint32_t value)
+        {
+            const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+
+            size_t i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const auto mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, needle))));
+                if (mask != 0)
+                    return data + i + std::countr_zero(mask);
+            }
+
+            return find_u32_scalar(data + i, size - i, value);
+        }
+#endif
+
+        struct KernelTable
+        {
+            size_t (*count_u8)(const std::uint8_t*, size_t, std::uint8_t) = count_u8_scalar;
+            size_t (*count_u32)(const std::uint32_t*, size_t, std::uint32_t) = count_u32_scalar;
+            const std::uint32_t* (*find_u32)(const std::uint32_t*, size_t, std::uint32_t) = find_u32_scalar;
+        };
+
+        inline KernelTable select(const CpuFeatures& features)
+        {
+            KernelTable table;
+#ifdef DUAL_PATH_X86_KERNELS
+            if (features.avx2)
+            {
+                table.count_u8 = count_u8_avx2;
+                table.count_u32 = count_u32_avx2;
+                table.find_u32 = find_u32_avx2;
+            }
+#endif
+            return table;
+        }
+    } // namespace kernels
+
+    // function-local statics - initialized on first use, also when that happens during static initialization of another TU
+    inline const CpuFeatures& cpu_features()
+    {
+        static const CpuFeatures features = detect_cpu_features();
+        return features;
+    }
+
+    inline const kernels::KernelTable& active_kernels()
+    {
+        static const kernels::KernelTable table = kernels::select(cpu_features()); // dispatch decided once
+        return table;
+    }
+
+    template <typename T>
+    concept ByteSized = std::is_trivially_copyable_v<T> && sizeof(T) == 1;
+
+    template <typename T>
+    concept DwordSized = (std::integral<T> || std::is_enum_v<T>) && sizeof(T) == 4;
+
+    // types whose equality is equivalent to equality of their object representation
+    template <typename T>
+    concept BitwiseComparable = std::integral<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+    template <typename CharT>
+    constexpr size_t length(const CharT* str)
+    {
+        if (std::is_constant_evaluated())
+        {
+            size_t idx = 0;
+            while (str[idx] != CharT{})
+                ++idx;
+            return idx;
+        }
+        else if constexpr (std::same_as<CharT, char>)
+        {
+            return std::strlen(str);
+        }
+        else if constexpr (std::same_as<CharT, wchar_t>)
+        {
+            return std::wcslen(str);
+        }
+        else
+        {
+            size_t idx = 0;
+            while (str[idx] != CharT{})
+                ++idx;
+            return idx;
+        }
+    }
+
+    template <typename TRange>
+    concept ContiguousRange = std::ranges::contiguous_range<TRange> && std::ranges::sized_range<TRange>;
+
+    // returns index of the first occurrence of value or size of data
+    template <ContiguousRange TRange>
+    constexpr size_t find(const TRange& data, const std::ranges::range_value_t<TRange>& value)
+    {
+        using T = std::ranges::range_value_t<TRange>;
+
+        const auto* first = std::ranges::data(data);
+        const size_t size = std::ranges::size(data);
+
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (ByteSized<T> && BitwiseComparable<T>)
+            {
+                auto pos = static_cast<const T*>(std::memchr(first, std::bit_cast<unsigned char>(value), size));
+                return pos ? pos - first : size;
+            }
+            else if constexpr (DwordSized<T>)
+            {
+                auto words = reinterpret_cast<const std::uint32_t*>(first);
+                return active_kernels().find_u32(words, size, std::bit_cast<std::uint32_t>(value)) - words;
+            }
+        }
+
+        return std::find(first, first + size, value) - first;
+    }
+
+    template <ContiguousRange TRange>
+    constexpr size_t count(const TRange& data, const std::ranges::range_value_t<TRange>& value)
+    {
+        using T = std::ranges::range_value_t<TRange>;
+
+        const auto* first = std::ranges::data(data);
+        const size_t size = std::ranges::size(data);
+
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (ByteSized<T> && BitwiseComparable<T>)
+                return active_kernels().count_u8(reinterpret_cast<const std::uint8_t*>(first), size, std::bit_cast<std::uint8_t>(value));
+            else if constexpr (DwordSized<T>)
+                return active_kernels().count_u32(reinterpret_cast<const std::uint32_t*>(first), size, std::bit_cast<std::uint32_t>(value));
+        }
+
+        size_t result = 0;
+        for (size_t i = 0; i < size; ++i)
+            result += first[i] == value;
+        return result;
+    }
+
+    template <ContiguousRange TRange1, ContiguousRange TRange2>
+        requires std::same_as<std::ranges::range_value_t<TRange1>, std::ranges::range_value_t<TRange2>>
+    constexpr bool equal(const TRange1& lhs, const TRange2& rhs)
+    {
+        using T = std::ranges::range_value_t<TRange1>;
+
+        const size_t size = std::ranges::size(lhs);
+        if (size != std::ranges::size(rhs))
+            return false;
+
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (BitwiseComparable<T>)
+                return size == 0 || std::memcmp(std::ranges::data(lhs), std::ranges::data(rhs), size * sizeof(T)) == 0;
+        }
+
+        return std::equal(std::ranges::data(lhs), std::ranges::data(lhs) + size, std::ranges::data(rhs));
+    }
+
+    // lexicographical three-way comparison
+    template <ContiguousRange TRange1, ContiguousRange TRange2>
+        requires std::same_as<std::ranges::range_value_t<TRange1>, std::ranges::range_value_t<TRange2>>
+    constexpr auto compare(const TRange1& lhs, const TRange2& rhs)
+    {
+        using T = std::ranges::range_value_t<TRange1>;
+
+        const auto* lhs_first = std::ranges::data(lhs);
+        const auto* rhs_first = std::ranges::data(rhs);
+        const size_t lhs_size = std::ranges::size(lhs);
+        const size_t rhs_size = std::ranges::size(rhs);
+
+        if (!std::is_constant_evaluated())
+        {
+            // memcmp compares unsigned bytes - matches operator<=> for unsigned 1-byte types only
+            if constexpr (ByteSized<T> && std::unsigned_integral<T>)
+            {
+                const size_t common_size = std::min(lhs_size, rhs_size);
+                if (const int result = common_size ? std::memcmp(lhs_first, rhs_first, common_size) : 0; result != 0)
+                    return result < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+                return lhs_size <=> rhs_size;
+            }
+        }
+
+        return std::lexicographical_compare_three_way(lhs_first, lhs_first + lhs_size, rhs_first, rhs_first + rhs_size);
+    }
+
+    template <ContiguousRange TRange>
+    constexpr void fill(TRange&& data, const std::ranges::range_value_t<TRange>& value)
+    {
+        using T = std::ranges::range_value_t<TRange>;
+
+        auto* first = std::ranges::data(data);
+        const size_t size = std::ranges::size(data);
+
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (ByteSized<T>)
+            {
+                std::memset(first, std::bit_cast<unsigned char>(value), size);
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            first[i] = value;
+    }
+
+    namespace details
+    {
+        // out in (first, first + size) - a forward copy would overwrite source items before reading them
+        template <typename T>
+        constexpr bool starts_inside(const T* out, const T* first, size_t size)
+        {
+            if (std::is_constant_evaluated())
+            {
+                // relational comparison of unrelated pointers is not a constant expression - equality is
+                for (size_t i = 1; i < size; ++i)
+                    if (first + i == out)
+                        return true;
+                return false;
+            }
+
+            return std::less<>{}(first, out) && std::less<>{}(out, first + size);
+        }
+    } // namespace details
+
+    // copies source to the beginning of destination (ranges may overlap - memmove semantics); destination must be large enough
+    template <ContiguousRange TSource, ContiguousRange TDestination>
+        requires std::same_as<std::ranges::range_value_t<TSource>, std::ranges::range_value_t<TDestination>>
+    constexpr void copy(const TSource& source, TDestination&& destination)
+    {
+        using T = std::ranges::range_value_t<TSource>;
+
+        const auto* first = std::ranges::data(source);
+        const size_t size = std::ranges::size(source);
+        auto* out = std::ranges::data(destination);
+
+        if (!std::is_constant_evaluated())
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (size != 0)
+                    std::memmove(out, first, size * sizeof(T));
+                return;
+            }
+        }
+
+        if (details::starts_inside(out, first, size))
+            std::copy_backward(first, first + size, out + size);
+        else
+            std::copy(first, first + size, out);
+    }
+} // namespace dual_path
+
+#endif
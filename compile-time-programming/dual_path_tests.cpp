@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helpers.hpp>
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "dual_path.hpp"
+
+using namespace std::literals;
+
+namespace
+{
+    constexpr auto compile_time_results()
+    {
+        std::array<int, 10> data{};
+        dual_path::fill(data, 7);
+
+        std::array<int, 3> head = {1, 2, 3};
+        dual_path::copy(head, data);
+
+        return std::tuple{dual_path::count(data, 7), dual_path::find(data, 3), dual_path::equal(head, std::span{data}.first(3))};
+    }
+
+    // destination starts inside the source - items are copied from the back like memmove does
+    constexpr auto overlapping_copy()
+    {
+        std::array<int, 7> data = {1, 2, 3, 4, 5, 0, 0};
+        dual_path::copy(std::span{data}.first(5), std::span{data}.subspan(2));
+        return data;
+    }
+} // namespace
+
+TEST_CASE("dual path - compile-time")
+{
+    static_assert(dual_path::length("abc") == 3);
+    static_assert(dual_path::length(L"abcd") == 4);
+    static_assert(compile_time_results() == std::tuple{7u, 2u, true});
+    static_assert(overlapping_copy() == std::array{1, 2, 1, 2, 3, 4, 5});
+    CHECK(overlapping_copy() == std::array{1, 2, 1, 2, 3, 4, 5});
+    static_assert(dual_path::compare("abc"sv, "abd"sv) == std::strong_ordering::less);
+}
+
+TEST_CASE("dual path - runtime agrees with std algorithms")
+{
+    const auto dataset = helpers::create_dataset(helpers::Distribution::uniform, 1003, 42, {.low = 0, .high = 16});
+
+    SECTION("overlapping copy of non-trivially copyable items")
+    {
+        std::vector<std::string> words = {"a", "b", "c", "d", ""};
+        dual_path::copy(std::span{words}.first(4), std::span{words}.subspan(1));
+        CHECK(words == std::vector<std::string>{"a", "a", "b", "c", "d"});
+
+        dual_path::copy(std::span{words}.subspan(1), words); // destination before the source - forward copy
+        CHECK(words == std::vector<std::string>{"a", "b", "c", "d", "d"});
+    }
+
+    SECTION("length")
+    {
+        std::string text(100, 'x');
+        CHECK(dual_path::length(text.c_str()) == 100);
+        CHECK(dual_path::length(u"utf-16") == 6);
+    }
+
+    SECTION("int - count & find (all tails)")
+    {
+        for (size_t size : {0, 1, 7, 8, 9, 31, 1003})
+        {
+            std::span data{dataset.data(), size};
+
+            for (int value : {0, 5, 15, 100})
+            {
+                CHECK(dual_path::count(data, value) == static_cast<size_t>(std::ranges::count(data, value)));
+                CHECK(dual_path::find(data, value) == static_cast<size_t>(std::ranges::find(data, value) - data.begin()));
+            }
+        }
+    }
+
+    SECTION("bytes - count & find")
+    {
+        std::vector<uint8_t> bytes(dataset.begin(), dataset.end());
+
+        CHECK(dual_path::count(bytes, 3) == static_cast<size_t>(std::ranges::count(bytes, 3)));
+        CHECK(dual_path::find(bytes, 3) == static_cast<size_t>(std::ranges::find(bytes, 3) - bytes.begin()));
+        CHECK(dual_path::find(bytes, 200) == bytes.size());
+    }
+
+    SECTION("equal & compare")
+    {
+        std::vector<int> copy_of_data(dataset.size());
+        dual_path::copy(dataset, copy_of_data);
+
+        CHECK(dual_path::equal(dataset, copy_of_data));
+        copy_of_data.back() = -1;
+        CHECK_FALSE(dual_path::equal(dataset, copy_of_data));
+
+        CHECK(dual_path::compare(dataset, copy_of_data) == std::strong_ordering::greater);
+        CHECK(dual_path::compare("abc"sv, "abcd"sv) == std::strong_ordering::less);
+        const auto high_char = "\x80"sv, low_char = "\x01"sv; // element-wise like std algorithms - char may be signed
+        CHECK(dual_path::compare(high_char, low_char) == std::lexicographical_compare_three_way(high_char.begin(), high_char.end(), low_char.begin(), low_char.end()));
+
+        std::vector<uint8_t> high = {0x80}, low = {0x01};
+        CHECK(dual_path::compare(high, low) == std::strong_ordering::greater);
+    }
+
+    SECTION("fill")
+    {
+        std::vector<int> ints(100);
+        dual_path::fill(ints, 42);
+        CHECK(std::ranges::count(ints, 42) == 100);
+
+        std::string text(10, ' ');
+        dual_path::fill(text, '*');
+        CHECK(text == "**********");
+    }
+}
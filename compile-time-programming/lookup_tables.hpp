@@ -0,0 +1,213 @@
+#ifndef LOOKUP_TABLES_HPP
+#define LOOKUP_TABLES_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace lut
+{
+    namespace details
+    {
+        template <typename F, size_t... Dims>
+        struct TableBuilder;
+
+        template <typename F, size_t Dim>
+        struct TableBuilder<F, Dim>
+        {
+            template <typename... TIndexes>
+            static consteval auto build(F& f, TIndexes... indexes)
+            {
+                using TValue = std::invoke_result_t<F&, TIndexes..., size_t>;
+
+                std::array<TValue, Dim> table{};
+                for (size_t i = 0; i < Dim; ++i)
+                    table[i] = f(indexes..., i);
+
+                return table;
+            }
+        };
+
+        template <typename F, size_t Dim, size_t... Dims>
+            requires(sizeof...(Dims) > 0)
+        struct TableBuilder<F, Dim, Dims...>
+        {
+            template <typename... TIndexes>
+            static consteval auto build(F& f, TIndexes... indexes)
+            {
+                using TRow = decltype(TableBuilder<F, Dims...>::build(f, indexes..., size_t{}));
+
+                std::array<TRow, Dim> table{};
+                for (size_t i = 0; i < Dim; ++i)
+                    table[i] = TableBuilder<F, Dims...>::build(f, indexes..., i);
+
+                return table;
+            }
+        };
+    } // namespace details
+
+    // table[i][j]... = f(i, j, ...) - evaluated entirely at compile time
+    template <size_t... Dims, typename F>
+        requires(sizeof...(Dims) > 0)
+    consteval auto make_lut(F f)
+    {
+        return details::TableBuilder<F, Dims...>::build(f);
+    }
+
+    // table over the whole domain of Index (e.g. 256 entries for uint8_t) stored as (possibly narrower) Value
+    template <std::integral Index, typename Value, typename F>
+        requires(sizeof(Index) <= 2)
+    consteval auto make_lut(F f)
+    {
+        constexpr size_t size = size_t{1} << std::numeric_limits<std::make_unsigned_t<Index>>::digits;
+
+        std::array<Value, size> table{};
+        for (size_t i = 0; i < size; ++i)
+            table[i] = static_cast<Value>(f(static_cast<std::make_unsigned_t<Index>>(i)));
+
+        return table;
+    }
+
+    //////////////////////////////////////////////////
+    // ready-made tables
+
+    inline constexpr std::uint8_t invalid = 0xFF;
+
+    inline constexpr auto crc32_table = make_lut<std::uint8_t, std::uint32_t>([](std::uint32_t byte) {
+        std::uint32_t crc = byte;
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        return crc;
+    });
+
+    inline constexpr auto popcount_table = make_lut<std::uint8_t, std::uint8_t>([](std::uint8_t byte) {
+        return std::popcount(byte);
+    });
+
+    inline constexpr auto bit_reverse_table = make_lut<std::uint8_t, std::uint8_t>([](std::uint8_t byte) {
+        std::uint8_t reversed = 0;
+        for (int bit = 0; bit < 8; ++bit)
+            reversed |= ((byte >> bit) & 1u) << (7 - bit);
+        return reversed;
+    });
+
+    inline constexpr auto hex_decode_table = make_lut<char, std::uint8_t>([](unsigned char c) -> std::uint8_t {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return invalid;
+    });
+
+    inline constexpr auto base64_decode_table = make_lut<char, std::uint8_t>([](unsigned char c) -> std::uint8_t {
+        constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        auto pos = alphabet.find(static_cast<char>(c));
+        return pos == std::string_view::npos ? invalid : static_cast<std::uint8_t>(pos);
+    });
+
+    inline constexpr auto ascii_case_fold_table = make_lut<char, char>([](unsigned char c) {
+        return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    });
+
+    //////////////////////////////////////////////////
+    // table-driven kernels
+
+    constexpr std::uint32_t crc32(std::span<const std::uint8_t> data, std::uint32_t crc = 0)
+    {
+        crc = ~crc;
+        for (std::uint8_t byte : data)
+            crc = crc32_table[(crc ^ byte) & 0xFFu] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    constexpr std::uint32_t crc32(std::string_view text)
+    {
+        std::uint32_t crc = ~0u;
+        for (char c : text)
+            crc = crc32_table[(crc ^ static_cast<std::uint8_t>(c)) & 0xFFu] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    constexpr size_t popcount(std::span<const std::uint8_t> data)
+    {
+        size_t count = 0;
+        for (std::uint8_t byte : data)
+            count += popcount_table[byte];
+        return count;
+    }
+
+    constexpr std::uint32_t reverse_bits(std::uint32_t value)
+    {
+        return (std::uint32_t{bit_reverse_table[value & 0xFFu]} << 24) | (std::uint32_t{bit_reverse_table[(value >> 8) & 0xFFu]} << 16)
+            | (std::uint32_t{bit_reverse_table[(value >> 16) & 0xFFu]} << 8) | std::uint32_t{bit_reverse_table[value >> 24]};
+    }
+
+    constexpr void to_lower(std::span<char> text)
+    {
+        for (char& c : text)
+            c = ascii_case_fold_table[static_cast<unsigned char>(c)];
+    }
+
+    // returns number of decoded bytes or std::nullopt for odd length or non-hex digits
+    constexpr std::optional<size_t> hex_decode(std::string_view hex, std::span<std::uint8_t> out)
+    {
+        if (hex.size() % 2 != 0 || out.size() < hex.size() / 2)
+            return std::nullopt;
+
+        std::uint8_t errors = 0;
+        for (size_t i = 0; i < hex.size() / 2; ++i)
+        {
+            const std::uint8_t high = hex_decode_table[static_cast<unsigned char>(hex[2 * i])];
+            const std::uint8_t low = hex_decode_table[static_cast<unsigned char>(hex[2 * i + 1])];
+            errors |= (high | low) & 0xF0u; // branch-free validation - invalid is 0xFF
+            out[i] = static_cast<std::uint8_t>((high << 4) | (low & 0x0Fu));
+        }
+
+        if (errors)
+            return std::nullopt;
+        return hex.size() / 2;
+    }
+
+    // returns number of decoded bytes or std::nullopt for invalid input; '=' padding is optional
+    constexpr std::optional<size_t> base64_decode(std::string_view base64, std::span<std::uint8_t> out)
+    {
+        while (!base64.empty() && base64.back() == '=')
+            base64.remove_suffix(1);
+
+        const size_t decoded_size = base64.size() * 3 / 4;
+        if (base64.size() % 4 == 1 || out.size() < decoded_size)
+            return std::nullopt;
+
+        std::uint8_t errors = 0;
+        std::uint32_t bits = 0;
+        size_t bit_count = 0;
+        size_t pos = 0;
+        for (char c : base64)
+        {
+            const std::uint8_t value = base64_decode_table[static_cast<unsigned char>(c)];
+            errors |= value & 0xC0u;
+            bits = (bits << 6) | (value & 0x3Fu);
+            bit_count += 6;
+            if (bit_count >= 8)
+            {
+                bit_count -= 8;
+                out[pos++] = static_cast<std::uint8_t>(bits >> bit_count);
+            }
+        }
+
+        if (errors)
+            return std::nullopt;
+        return pos;
+    }
+} // namespace lut
+
+#endif
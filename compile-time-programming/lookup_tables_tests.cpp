@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+
+#include "lookup_tables.hpp"
+
+using namespace std::literals;
+
+TEST_CASE("make_lut")
+{
+    SECTION("1D - squares like create_powers")
+    {
+        constexpr auto squares = lut::make_lut<20>([](size_t i) { return static_cast<uint32_t>((i + 1) * (i + 1)); });
+
+        static_assert(squares.size() == 20);
+        static_assert(squares[6] == 49);
+    }
+
+    SECTION("2D")
+    {
+        constexpr auto multiplication_table = lut::make_lut<10, 10>([](size_t row, size_t col) { return static_cast<uint8_t>(row * col); });
+
+        static_assert(multiplication_table[7][8] == 56);
+        static_assert(sizeof(multiplication_table) == 100);
+    }
+
+    SECTION("3D")
+    {
+        constexpr auto table = lut::make_lut<2, 3, 4>([](size_t i, size_t j, size_t k) { return i * 100 + j * 10 + k; });
+
+        static_assert(table[1][2][3] == 123);
+    }
+
+    SECTION("whole domain of index type with compact storage")
+    {
+        constexpr auto parity = lut::make_lut<uint8_t, bool>([](uint8_t byte) { return std::popcount(byte) % 2 == 1; });
+
+        static_assert(parity.size() == 256);
+        static_assert(sizeof(parity) == 256);
+        static_assert(parity[0b0000'0111]);
+        static_assert(!parity[0b0000'0011]);
+    }
+}
+
+TEST_CASE("ready-made tables")
+{
+    SECTION("crc32")
+    {
+        static_assert(lut::crc32("123456789") == 0xCBF43926);
+
+        std::array<uint8_t, 9> data = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        CHECK(lut::crc32(data) == 0xCBF43926);
+    }
+
+    SECTION("popcount & bit reverse")
+    {
+        static_assert(lut::popcount_table[0xFF] == 8);
+
+        std::array<uint8_t, 3> data = {0x01, 0x03, 0xF0};
+        CHECK(lut::popcount(data) == 7);
+
+        static_assert(lut::reverse_bits(0x0000'0001) == 0x8000'0000);
+        CHECK(lut::reverse_bits(0x1234'5678) == 0x1E6A'2C48);
+    }
+
+    SECTION("ASCII case fold")
+    {
+        std::string text = "Hello, World! 123";
+        lut::to_lower(text);
+
+        CHECK(text == "hello, world! 123");
+    }
+
+    SECTION("hex decode")
+    {
+        std::array<uint8_t, 4> out{};
+
+        CHECK(lut::hex_decode("DEADbeef", out) == 4);
+        CHECK(out == std::array<uint8_t, 4>{0xDE, 0xAD, 0xBE, 0xEF});
+
+        CHECK_FALSE(lut::hex_decode("DEADbeeg", out).has_value());
+        CHECK_FALSE(lut::hex_decode("ABC", out).has_value());
+    }
+
+    SECTION("base64 decode")
+    {
+        std::array<uint8_t, 16> out{};
+
+        auto size = lut::base64_decode("Q3BwMjA=", out);
+        REQUIRE(size == 5);
+        CHECK(std::string(out.begin(), out.begin() + *size) == "Cpp20");
+
+        CHECK_FALSE(lut::base64_decode("Q3B*MjA=", out).has_value());
+    }
+}
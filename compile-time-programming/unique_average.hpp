@@ -0,0 +1,210 @@
+#ifndef UNIQUE_AVERAGE_HPP
+#define UNIQUE_AVERAGE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <std::ranges::input_range... TRng_>
+constexpr auto avg_for_unique(const TRng_&... rng)
+{
+    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+    std::vector<TElement> vec;                            // empty vector
+    vec.reserve((rng.size() + ...));                      // reserve a buffer - fold expression C++17
+    (vec.insert(vec.end(), rng.begin(), rng.end()), ...); // fold expression C++17
+
+    // sort items
+    std::ranges::sort(vec); // std::sort(vec.begin(), vec.end());
+
+    // create span of unique_items
+    auto new_end = std::unique(vec.begin(), vec.end());
+    std::span unique_items{vec.begin(), new_end};
+
+    // calculate sum of unique items
+    auto sum = std::accumulate(unique_items.begin(), unique_items.end(), TElement{});
+
+    return sum / static_cast<double>(unique_items.size());
+}
+
+// k-way merge of already sorted ranges with on-the-fly deduplication - no allocation, O(k * N)
+template <std::ranges::input_range... TRng_>
+constexpr auto avg_for_unique_sorted(const TRng_&... rng)
+{
+    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+    std::tuple heads{std::ranges::begin(rng)...};
+    const std::tuple ends{std::ranges::end(rng)...};
+
+    TElement sum{};
+    size_t count = 0;
+
+    auto for_each_head = [&]<size_t... Is>(auto action, std::index_sequence<Is...>) {
+        (action(std::get<Is>(heads), std::get<Is>(ends)), ...);
+    };
+
+    while (true)
+    {
+        std::optional<TElement> min_value;
+        for_each_head([&](const auto& head, const auto& end) {
+            if (head != end && (!min_value || *head < *min_value))
+                min_value = *head;
+        }, std::index_sequence_for<TRng_...>{});
+
+        if (!min_value)
+            break;
+
+        // skip all copies of the smallest value - in every range
+        for_each_head([&](auto& head, const auto& end) {
+            while (head != end && *head == *min_value)
+                ++head;
+        }, std::index_sequence_for<TRng_...>{});
+
+        sum += *min_value;
+        ++count;
+    }
+
+    return sum / static_cast<double>(count);
+}
+
+// open-addressing (linear probing) hash set - flat storage, grows when half full
+template <typename T, typename THash = std::hash<T>>
+class OpenAddressingSet
+{
+public:
+    explicit OpenAddressingSet(size_t expected_size = 0)
+        : slots_(std::bit_ceil(std::max<size_t>(2 * expected_size, 16)))
+        , occupied_(slots_.size())
+    {
+    }
+
+    // returns true if value was not in the set yet
+    bool insert(const T& value)
+    {
+        if (2 * (size_ + 1) > slots_.size())
+            rehash(2 * slots_.size());
+
+        const size_t mask = slots_.size() - 1;
+        for (size_t pos = mix(THash{}(value)) & mask;; pos = (pos + 1) & mask)
+        {
+            if (!occupied_[pos])
+            {
+                occupied_[pos] = true;
+                slots_[pos] = value;
+                ++size_;
+                return true;
+            }
+
+            if (slots_[pos] == value)
+                return false;
+        }
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    std::vector<T> slots_;
+    std::vector<uint8_t> occupied_;
+    size_t size_ = 0;
+
+    // std::hash of integers is the identity - spread the bits before masking
+    static constexpr size_t mix(size_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    void rehash(size_t new_capacity)
+    {
+        OpenAddressingSet resized;
+        resized.slots_.resize(new_capacity);
+        resized.occupied_.resize(new_capacity);
+
+        for (size_t pos = 0; pos < slots_.size(); ++pos)
+            if (occupied_[pos])
+                resized.insert(slots_[pos]);
+
+        *this = std::move(resized);
+    }
+};
+
+// unsorted input - O(N) expected time, memory proportional to the number of items
+template <std::ranges::input_range... TRng_>
+auto avg_for_unique_hashed(const TRng_&... rng)
+{
+    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+    OpenAddressingSet<TElement> unique_items((std::ranges::size(rng) + ...));
+    TElement sum{};
+
+    auto add_unique = [&](const auto& items) {
+        for (const auto& item : items)
+            if (unique_items.insert(item))
+                sum += item;
+    };
+    (add_unique(rng), ...);
+
+    return sum / static_cast<double>(unique_items.size());
+}
+
+// chunks are sorted in parallel and then merged pairwise in parallel
+template <typename T>
+void parallel_sort(std::span<T> data, size_t max_threads = std::thread::hardware_concurrency(), size_t min_chunk_size = 64 * 1024)
+{
+    const size_t chunk_count = std::clamp<size_t>(data.size() / std::max<size_t>(min_chunk_size, 1), 1, std::max<size_t>(max_threads, 1));
+
+    std::vector<size_t> bounds(chunk_count + 1);
+    for (size_t i = 0; i <= chunk_count; ++i)
+        bounds[i] = data.size() * i / chunk_count;
+
+    {
+        std::vector<std::jthread> workers;
+        for (size_t i = 0; i < chunk_count; ++i)
+            workers.emplace_back([=] { std::sort(data.begin() + bounds[i], data.begin() + bounds[i + 1]); });
+    }
+
+    for (size_t step = 1; step < chunk_count; step *= 2)
+    {
+        std::vector<std::jthread> workers;
+        for (size_t i = 0; i + step < chunk_count; i += 2 * step)
+        {
+            const size_t first = bounds[i];
+            const size_t middle = bounds[i + step];
+            const size_t last = bounds[std::min(i + 2 * step, chunk_count)];
+            workers.emplace_back([=] { std::inplace_merge(data.begin() + first, data.begin() + middle, data.begin() + last); });
+        }
+    }
+}
+
+// very large input - parallel sort followed by a single deduplicating pass
+template <std::ranges::input_range... TRng_>
+auto avg_for_unique_parallel(const TRng_&... rng)
+{
+    using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+
+    std::vector<TElement> vec;
+    vec.reserve((std::ranges::size(rng) + ...));
+    (vec.insert(vec.end(), std::ranges::begin(rng), std::ranges::end(rng)), ...);
+
+    parallel_sort(std::span{vec});
+
+    return avg_for_unique_sorted(vec);
+}
+
+#endif
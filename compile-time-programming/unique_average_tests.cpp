@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helpers.hpp>
+#include <algorithm>
+#include <array>
+#include <list>
+#include <vector>
+
+#include "unique_average.hpp"
+
+TEST_CASE("avg for unique - sorted inputs")
+{
+    SECTION("compile-time")
+    {
+        constexpr std::array lst1 = {1, 2, 3, 4, 5};
+        constexpr std::array lst2 = {5, 6, 7, 8, 9};
+
+        static_assert(avg_for_unique_sorted(lst1, lst2) == avg_for_unique(lst1, lst2));
+        static_assert(avg_for_unique_sorted(lst1, lst2) == 5.0);
+    }
+
+    SECTION("duplicates inside and across ranges of different types")
+    {
+        std::vector vec = {1, 1, 2, 2, 2, 10};
+        std::list lst = {2, 3, 3, 10};
+        std::array arr = {-4};
+
+        CHECK(avg_for_unique_sorted(vec, lst, arr) == (1 + 2 + 3 + 10 - 4) / 5.0);
+    }
+}
+
+TEST_CASE("avg for unique - all variants agree")
+{
+    for (auto distribution : helpers::all_distributions)
+    {
+        INFO(helpers::to_string(distribution));
+
+        auto data1 = helpers::create_dataset(distribution, 200'000, 42);
+        auto data2 = helpers::create_dataset(distribution, 50'000, 665);
+
+        const auto expected = avg_for_unique(data1, data2);
+
+        CHECK(avg_for_unique_hashed(data1, data2) == expected);
+        CHECK(avg_for_unique_parallel(data1, data2) == expected);
+
+        std::ranges::sort(data1);
+        std::ranges::sort(data2);
+        CHECK(avg_for_unique_sorted(data1, data2) == expected);
+    }
+}
+
+TEST_CASE("OpenAddressingSet")
+{
+    OpenAddressingSet<int> set(4);
+
+    CHECK(set.insert(1));
+    CHECK(set.insert(17));
+    CHECK_FALSE(set.insert(1));
+
+    for (int i = 0; i < 1000; ++i)
+        set.insert(i);
+
+    CHECK(set.size() == 1000);
+}
+
+TEST_CASE("parallel_sort")
+{
+    for (size_t threads : {1, 2, 3, 4, 7})
+    {
+        INFO("threads: " << threads);
+
+        auto data = helpers::create_dataset(helpers::Distribution::uniform, 10'007, 42, {.low = -1000, .high = 1000});
+        parallel_sort(std::span{data}, threads, 100);
+
+        CHECK(std::ranges::is_sorted(data));
+    }
+}
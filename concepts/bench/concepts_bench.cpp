@@ -0,0 +1,99 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <concepts>
+#include <memory>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    struct BoundingBox
+    {
+        int w, h;
+    };
+
+    // static interface - calls are resolved at compile time and inlined
+    template <typename T>
+    concept Shape = requires(const T& obj) {
+        { obj.box() } noexcept -> std::same_as<BoundingBox>;
+    };
+
+    struct Rect
+    {
+        int w, h;
+
+        BoundingBox box() const noexcept
+        {
+            return {w, h};
+        }
+    };
+
+    template <Shape T>
+    long total_area(const std::vector<T>& shapes)
+    {
+        long area = 0;
+        for (const auto& shape : shapes)
+        {
+            const auto [w, h] = shape.box();
+            area += static_cast<long>(w) * h;
+        }
+        return area;
+    }
+
+    // dynamic interface - one indirect call and one pointer chase per shape
+    struct IShape
+    {
+        virtual ~IShape() = default;
+        virtual BoundingBox box() const noexcept = 0;
+    };
+
+    struct VirtualRect : IShape
+    {
+        int w, h;
+
+        VirtualRect(int w, int h)
+            : w{w}
+            , h{h}
+        {
+        }
+
+        BoundingBox box() const noexcept override
+        {
+            return {w, h};
+        }
+    };
+
+    long total_area(const std::vector<std::unique_ptr<IShape>>& shapes)
+    {
+        long area = 0;
+        for (const auto& shape : shapes)
+        {
+            const auto [w, h] = shape->box();
+            area += static_cast<long>(w) * h;
+        }
+        return area;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("concepts - total area of 1M shapes")
+{
+    constexpr size_t count = 1'000'000;
+
+    helpers::random::PCG rnd{42};
+    std::vector<Rect> rects;
+    std::vector<std::unique_ptr<IShape>> virtual_rects;
+    rects.reserve(count);
+    virtual_rects.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const int w = static_cast<int>(rnd() % 100);
+        const int h = static_cast<int>(rnd() % 100);
+        rects.push_back({w, h});
+        virtual_rects.push_back(std::make_unique<VirtualRect>(w, h));
+    }
+
+    bench.run("template <Shape T> - std::vector<Rect>", [&] { do_not_optimize(total_area(rects)); });
+    bench.run("virtual box() - std::vector<std::unique_ptr<IShape>>", [&] { do_not_optimize(total_area(virtual_rects)); });
+}
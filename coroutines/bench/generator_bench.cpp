@@ -0,0 +1,51 @@
+#include <benchmark.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include "generator.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    std::vector<long> squares(int n)
+    {
+        std::vector<long> vec(n);
+        for (int i = 0; i < n; ++i)
+            vec[i] = static_cast<long>(i) * i;
+        return vec;
+    }
+
+    FutureStd::Generator<long> squares_gen(int n)
+    {
+        for (int i = 0; i < n; ++i)
+            co_yield static_cast<long>(i) * i;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("coroutines - sum of 1M squares")
+{
+    int count = 1'000'000;
+    do_not_optimize(count); // unknown to the optimizer - the plain loop is not folded to a constant
+
+    bench.run("plain loop", [&] {
+        long sum = 0;
+        for (int i = 0; i < count; ++i)
+            sum += static_cast<long>(i) * i;
+        do_not_optimize(sum);
+    });
+
+    bench.run("std::vector<long> squares(n)", [&] {
+        const auto vec = squares(count);
+        do_not_optimize(std::accumulate(vec.begin(), vec.end(), 0L));
+    });
+
+    // one resume and one suspend per item - no memory for the whole sequence
+    bench.run("Generator<long> squares_gen(n)", [&] {
+        long sum = 0;
+        for (long square : squares_gen(count))
+            sum += square;
+        do_not_optimize(sum);
+    });
+}
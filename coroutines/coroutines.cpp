@@ -6,6 +6,8 @@
 #include <utility>
 #include <ranges>
 
+#include "generator.hpp"
+
 using namespace std::literals;
 
 class TaskResumer
@@ -94,160 +96,6 @@ TEST_CASE("first coroutine")
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace FutureStd
-{
-    template <typename T>
-    class [[nodiscard]] Generator
-    {
-    public:
-        struct promise_type;
-
-        using CoroutineHandle = std::coroutine_handle<promise_type>;
-
-        struct promise_type
-        {
-            Generator get_return_object()
-            {
-                return Generator{CoroutineHandle::from_promise(*this)};
-            }
-
-            std::suspend_always initial_suspend() const { return {}; }
-
-            std::suspend_always final_suspend() const noexcept { return {}; }
-
-            void unhandled_exception() { std::terminate(); }
-
-            std::suspend_always yield_value(auto&& yielded_value)
-            {
-                value = std::forward<decltype(yielded_value)>(yielded_value);
-                return {};
-            }
-
-            void return_void() { }
-
-            T value;
-        };
-
-        struct iterator
-        {
-            using value_type = T;
-            using reference = T;
-            using iterator_category = std::input_iterator_tag;
-
-            CoroutineHandle coroutine_handle_ = nullptr;
-
-            iterator() = default;
-
-            iterator(auto coroutine_handle)
-                : coroutine_handle_{coroutine_handle}
-            { }
-
-            T operator*() const
-            {
-                assert(coroutine_handle_ != nullptr);
-                return coroutine_handle_.promise().value;
-            }
-
-            T* operator->() const
-            {
-                assert(coroutine_handle_ != nullptr);
-                return &coroutine_handle_.promise().value;
-            }
-
-            iterator& operator++()
-            {
-                move_to_next();
-                return *this;
-            }
-
-            iterator operator++(int)
-            {
-                iterator prev_pos = *this;
-                move_to_next();
-                return prev_pos;
-            }
-
-            bool operator==(const iterator& other) const = default;
-
-        private:
-            friend class Generator;
-
-            void move_to_next()
-            {
-                if (coroutine_handle_ && !coroutine_handle_.done())
-                {
-                    coroutine_handle_.resume();
-
-                    if (coroutine_handle_.done())
-                    {
-                        coroutine_handle_ = nullptr;
-                    }
-                }
-            }
-        };
-
-        Generator(CoroutineHandle coroutine_hndl)
-            : coroutine_hndl_{coroutine_hndl}
-        { }
-
-        Generator(const Generator&) = delete;
-        Generator& operator=(const Generator&) = delete;
-
-        ~Generator()
-        {
-            if (coroutine_hndl_)
-                coroutine_hndl_.destroy();
-        }
-
-        std::optional<T> next_value()
-        {
-            assert(coroutine_hndl_);
-            // if (!coroutine_hndl_ || coroutine_hndl_.done())
-            //     return std::nullopt;
-
-            coroutine_hndl_.resume();
-
-            if (coroutine_hndl_.done())
-                return std::nullopt;
-
-            return coroutine_hndl_.promise().value;
-        }
-
-        iterator begin() const
-        {
-            if (!coroutine_hndl_ || coroutine_hndl_.done())
-                return {};
-
-            iterator it{coroutine_hndl_};
-            it.next();
-            return it;
-        }
-
-        iterator end() const
-        {
-            return {};
-        }
-
-        iterator begin()
-        {
-            if (!coroutine_hndl_ || coroutine_hndl_.done())
-                return {};
-
-            iterator it{coroutine_hndl_};
-            it.move_to_next();
-            return it;
-        }
-
-        iterator end()
-        {
-            return {};
-        }
-
-    private:
-        CoroutineHandle coroutine_hndl_;
-    };
-} // namespace FutureStd
-
 using FutureStd::Generator;
 
 Generator<int> fibonacci(int n)
@@ -0,0 +1,77 @@
+#include <benchmark.hpp>
+#include <fill.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // zero() from std-lib-cpp20 before it used helpers::fill
+    void element_loop(std::span<int> data, int value)
+    {
+        for (auto& item : data)
+            item = value;
+    }
+
+    std::string size_label(size_t bytes)
+    {
+        return bytes >= 1024 * 1024 ? std::to_string(bytes / (1024 * 1024)) + " MiB" : std::to_string(bytes / 1024) + " KiB";
+    }
+} // namespace
+
+HELPERS_BENCHMARK("fill - std::span<int>")
+{
+    const helpers::FillOptions cached_only{.streaming_threshold = SIZE_MAX};
+
+    for (size_t bytes : {size_t{16} * 1024, size_t{1} * 1024 * 1024, size_t{256} * 1024 * 1024})
+    {
+        std::vector<int> data(bytes / sizeof(int));
+        const std::string size = size_label(bytes);
+
+        for (int value : {0, 665})
+        {
+            const std::string prefix = size + ", value " + std::to_string(value) + " - ";
+
+            bench.run(prefix + "element loop", [&] {
+                element_loop(data, value);
+                do_not_optimize(data);
+            });
+
+            bench.run(prefix + "helpers::fill, cached stores", [&] {
+                helpers::fill(std::span{data}, value, cached_only);
+                do_not_optimize(data);
+            });
+
+            bench.run(prefix + "helpers::fill", [&] {
+                helpers::fill(std::span{data}, value);
+                do_not_optimize(data);
+            });
+        }
+    }
+}
+
+// what a huge fill does to the data used afterwards
+HELPERS_BENCHMARK("fill - 256 MiB fill followed by a sum over a 1 MiB working set")
+{
+    std::vector<int> buffer(256 * 1024 * 1024 / sizeof(int));
+    std::vector<int> working_set(1024 * 1024 / sizeof(int), 1);
+
+    auto sum_working_set = [&] { do_not_optimize(std::accumulate(working_set.begin(), working_set.end(), 0L)); };
+
+    bench.run("cached stores", [&] {
+        sum_working_set();
+        helpers::fill(std::span{buffer}, 665, {.streaming_threshold = SIZE_MAX});
+        sum_working_set();
+    });
+
+    bench.run("streaming stores", [&] {
+        sum_working_set();
+        helpers::fill(std::span{buffer}, 665, {.streaming_threshold = 0});
+        sum_working_set();
+    });
+}
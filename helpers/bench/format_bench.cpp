@@ -0,0 +1,49 @@
+#include <benchmark.hpp>
+#include <compiled_format.hpp>
+
+#include <format>
+#include <string>
+#include <string_view>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // print() from ex-compare without the output
+    std::string vformat_print(std::string_view format_sv, const auto&... args)
+    {
+        return std::vformat(format_sv, std::make_format_args(args...));
+    }
+} // namespace
+
+HELPERS_BENCHMARK("format - Gadget({}, {}).op<=>(Gadget({}, {}))")
+{
+    const std::string name = "ipad";
+    const double price = 1.99;
+    const std::string other_name = "mp3 player";
+    const double other_price = 665.5;
+
+    bench.run("std::vformat", [&] { do_not_optimize(vformat_print("Gadget({}, {}).op<=>(Gadget({}, {}))", name, price, other_name, other_price)); });
+
+    bench.run("std::format", [&] { do_not_optimize(std::format("Gadget({}, {}).op<=>(Gadget({}, {}))", name, price, other_name, other_price)); });
+
+    bench.run("helpers::format", [&] {
+        do_not_optimize(helpers::format<"Gadget({}, {}).op<=>(Gadget({}, {}))">(name, price, other_name, other_price));
+    });
+
+    char buffer[128];
+    bench.run("helpers::fmt_string::format_to - stack buffer", [&] {
+        do_not_optimize(helpers::fmt_string<"Gadget({}, {}).op<=>(Gadget({}, {}))">::format_to(buffer, name, price, other_name, other_price));
+        do_not_optimize(buffer);
+    });
+}
+
+HELPERS_BENCHMARK("format - Rating({}).op==({})")
+{
+    int value = 1;
+    int other_value = 42;
+
+    bench.run("std::vformat", [&] { do_not_optimize(vformat_print("Rating({}).op==({})", value, other_value)); });
+    bench.run("std::format", [&] { do_not_optimize(std::format("Rating({}).op==({})", value, other_value)); });
+    bench.run("helpers::format", [&] { do_not_optimize(helpers::format<"Rating({}).op==({})">(value, other_value)); });
+}
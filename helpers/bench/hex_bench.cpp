@@ -0,0 +1,65 @@
+#include <benchmark.hpp>
+#include <hex.hpp>
+#include <random.hpp>
+
+#include <cstdint>
+#include <format>
+#include <string>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    std::vector<std::byte> random_bytes(size_t size)
+    {
+        helpers::random::PCG rnd{665};
+        std::vector<std::byte> bytes(size);
+        for (auto& b : bytes)
+            b = static_cast<std::byte>(rnd());
+        return bytes;
+    }
+
+    // print_as_bytes() from std-lib-cpp20 before it used helpers::hex
+    std::string format_per_byte(std::span<const std::byte> bytes)
+    {
+        std::string result;
+        for (std::byte b : bytes)
+            result += std::format("{:02X}", std::to_integer<int>(b));
+        return result;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("hex - 16 MiB")
+{
+    const auto bytes = random_bytes(16 * 1024 * 1024);
+    const auto* data = reinterpret_cast<const std::uint8_t*>(bytes.data());
+
+    std::string hex(helpers::hex::encoded_size(bytes.size()), '\0');
+    std::vector<std::byte> decoded(bytes.size());
+
+    bench.run("encode - std::format per byte", [&] { do_not_optimize(format_per_byte(bytes)); });
+
+    bench.run("encode - 512-entry table", [&] {
+        helpers::hex::details::encode_scalar(data, bytes.size(), hex.data(), helpers::hex::Case::upper);
+        do_not_optimize(hex);
+    });
+
+    bench.run("encode - helpers::hex::encode (SIMD)", [&] {
+        helpers::hex::encode(bytes, hex);
+        do_not_optimize(hex);
+    });
+
+    bench.run("decode - table", [&] {
+        do_not_optimize(helpers::hex::details::decode_scalar(hex.data(), decoded.size(), reinterpret_cast<std::uint8_t*>(decoded.data())));
+        do_not_optimize(decoded);
+    });
+
+    bench.run("decode - helpers::hex::decode (SIMD)", [&] {
+        do_not_optimize(helpers::hex::decode(hex, decoded));
+        do_not_optimize(decoded);
+    });
+
+    std::vector<char> dump(helpers::hex::xxd_size(bytes.size()));
+    bench.run("xxd layout", [&] { do_not_optimize(helpers::hex::xxd(bytes, dump)); });
+}
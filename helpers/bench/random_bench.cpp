@@ -0,0 +1,86 @@
+#include <benchmark.hpp>
+#include <helpers.hpp>
+
+#include <random>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr size_t dataset_size = 1 << 20;
+}
+
+HELPERS_BENCHMARK("random - fill 1M x uint32_t")
+{
+    std::vector<uint32_t> data(dataset_size);
+
+    bench.run("std::mt19937", [&, rnd = std::mt19937{42}]() mutable {
+        std::ranges::generate(data, std::ref(rnd));
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCG", [&, rnd = helpers::random::PCG{42}]() mutable {
+        std::ranges::generate(data, std::ref(rnd));
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCGBatch<8>", [&, rnd = helpers::random::PCGBatch<8>{42}]() mutable {
+        rnd.fill(data);
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCGBatch<16>", [&, rnd = helpers::random::PCGBatch<16>{42}]() mutable {
+        rnd.fill(data);
+        do_not_optimize(data.data());
+    });
+}
+
+HELPERS_BENCHMARK("random - bounded 1M x [0, 200)")
+{
+    std::vector<uint32_t> data(dataset_size);
+
+    bench.run("PCG - modulo", [&, rnd = helpers::random::PCG{42}]() mutable {
+        std::ranges::generate(data, [&] { return rnd() % 200; });
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCG - Lemire", [&, rnd = helpers::random::PCG{42}]() mutable {
+        std::ranges::generate(data, [&] { return helpers::random::bounded(rnd, 200); });
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCGBatch<8> - Lemire", [&, rnd = helpers::random::PCGBatch<8>{42}]() mutable {
+        rnd.fill_bounded(data, 200);
+        do_not_optimize(data.data());
+    });
+}
+
+HELPERS_BENCHMARK("random - floats 1M x [0, 1)")
+{
+    std::vector<float> data(dataset_size);
+
+    bench.run("std::uniform_real_distribution", [&, rnd = std::mt19937{42}]() mutable {
+        std::uniform_real_distribution<float> distr{0.0f, 1.0f};
+        std::ranges::generate(data, [&] { return distr(rnd); });
+        do_not_optimize(data.data());
+    });
+
+    bench.run("PCGBatch<8>", [&, rnd = helpers::random::PCGBatch<8>{42}]() mutable {
+        rnd.fill(data);
+        do_not_optimize(data.data());
+    });
+}
+
+HELPERS_BENCHMARK("datasets - 1M x int")
+{
+    for (auto distribution : helpers::all_distributions)
+    {
+        std::vector<int> data(dataset_size);
+
+        bench.run(helpers::to_string(distribution), [&] {
+            helpers::generate_dataset(data, distribution);
+            do_not_optimize(data.data());
+        });
+    }
+}
@@ -0,0 +1,377 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#define HELPERS_BENCHMARK_PERF_EVENTS 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace helpers::benchmark
+{
+    // forces the compiler to materialize value - the computation producing it cannot be optimized away
+    template <typename T>
+    inline void do_not_optimize(const T& value)
+    {
+#ifdef _MSC_VER
+        static volatile const void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "m"(value) : "memory");
+#endif
+    }
+
+    template <typename T>
+    inline void do_not_optimize(T& value)
+    {
+#ifdef _MSC_VER
+        static volatile const void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#else
+        // single-alternative constraints - GCC 12 drops the initializing store of a local with "+m,r"
+        if constexpr (std::is_scalar_v<T>)
+            asm volatile("" : "+r"(value) : : "memory");
+        else
+            asm volatile("" : "+m"(value) : : "memory");
+#endif
+    }
+
+    // forces all pending writes to memory to be treated as observable
+    inline void clobber_memory()
+    {
+#ifdef _MSC_VER
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    struct Statistics
+    {
+        double min{};
+        double median{};
+        double mean{};
+        double p99{};
+        double p999{};
+        double max{};
+        double mad{}; // median absolute deviation
+
+        static Statistics from(std::vector<double> samples)
+        {
+            if (samples.empty())
+                return {};
+
+            std::ranges::sort(samples);
+
+            auto percentile = [](const std::vector<double>& sorted, double p) {
+                const auto rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+                return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+            };
+
+            auto median_of = [](const std::vector<double>& sorted) {
+                const size_t mid = sorted.size() / 2;
+                return sorted.size() % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2.0;
+            };
+
+            Statistics stats;
+            stats.min = samples.front();
+            stats.max = samples.back();
+            stats.median = median_of(samples);
+            stats.p99 = percentile(samples, 0.99);
+            stats.p999 = percentile(samples, 0.999);
+
+            double sum = 0.0;
+            for (double sample : samples)
+                sum += sample;
+            stats.mean = sum / samples.size();
+
+            std::vector<double> deviations;
+            deviations.reserve(samples.size());
+            for (double sample : samples)
+                deviations.push_back(std::abs(sample - stats.median));
+            std::ranges::sort(deviations);
+            stats.mad = median_of(deviations);
+
+            return stats;
+        }
+    };
+
+    struct CounterValues
+    {
+        double cycles{};
+        double instructions{};
+        double cache_misses{};
+        double branch_misses{};
+    };
+
+    // hardware counters via perf_event_open - unavailable (not an error) outside Linux or when perf_event_paranoid forbids it
+    class PerfCounters
+    {
+    public:
+        PerfCounters()
+        {
+#ifdef HELPERS_BENCHMARK_PERF_EVENTS
+            const std::uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+            for (auto config : configs)
+            {
+                perf_event_attr attr{};
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = config;
+                attr.disabled = fds_.empty() ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP;
+
+                const int group_fd = fds_.empty() ? -1 : fds_.front();
+                const int fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+                if (fd < 0)
+                {
+                    close_all();
+                    return;
+                }
+                fds_.push_back(fd);
+            }
+#endif
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        ~PerfCounters()
+        {
+            close_all();
+        }
+
+        bool available() const
+        {
+            return !fds_.empty();
+        }
+
+        void start()
+        {
+#ifdef HELPERS_BENCHMARK_PERF_EVENTS
+            if (available())
+            {
+                ::ioctl(fds_.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ::ioctl(fds_.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+#endif
+        }
+
+        std::optional<CounterValues> stop()
+        {
+#ifdef HELPERS_BENCHMARK_PERF_EVENTS
+            if (available())
+            {
+                ::ioctl(fds_.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+                std::uint64_t values[5]{}; // nr + 4 counters
+                if (::read(fds_.front(), values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)))
+                    return CounterValues{double(values[1]), double(values[2]), double(values[3]), double(values[4])};
+            }
+#endif
+            return std::nullopt;
+        }
+
+    private:
+        std::vector<int> fds_;
+
+        void close_all()
+        {
+#ifdef HELPERS_BENCHMARK_PERF_EVENTS
+            for (int fd : fds_)
+                ::close(fd);
+#endif
+            fds_.clear();
+        }
+    };
+
+    struct Options
+    {
+        std::chrono::nanoseconds warmup_time = std::chrono::milliseconds{50};
+        std::chrono::nanoseconds min_sample_time = std::chrono::milliseconds{5};
+        size_t samples = 31;
+        bool hardware_counters = true;
+    };
+
+    struct Result
+    {
+        std::string name;
+        size_t iterations_per_sample{};
+        Statistics ns_per_iteration;
+        std::optional<CounterValues> counters_per_iteration;
+    };
+
+    class Runner
+    {
+    public:
+        explicit Runner(Options options = {}, std::ostream& out = std::cout)
+            : options_{options}
+            , out_{out}
+        {
+        }
+
+        template <typename TFunction>
+        Result run(std::string_view name, TFunction&& fn)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            auto time_batch = [&](size_t iterations) {
+                const auto start = Clock::now();
+                for (size_t i = 0; i < iterations; ++i)
+                    fn();
+                clobber_memory();
+                return Clock::now() - start;
+            };
+
+            // calibration - grow the batch until it takes at least min_sample_time
+            size_t iterations = 1;
+            for (auto elapsed = time_batch(iterations); elapsed < options_.min_sample_time; elapsed = time_batch(iterations))
+            {
+                const double ratio = elapsed.count() > 0 ? double(options_.min_sample_time.count()) / elapsed.count() : 10.0;
+                iterations = std::max<size_t>(iterations + 1, static_cast<size_t>(iterations * std::min(ratio * 1.2, 10.0)));
+            }
+
+            // warm-up
+            for (const auto warmup_start = Clock::now(); Clock::now() - warmup_start < options_.warmup_time;)
+                time_batch(iterations);
+
+            std::vector<double> samples;
+            samples.reserve(options_.samples);
+            for (size_t i = 0; i < options_.samples; ++i)
+            {
+                const auto elapsed = std::chrono::duration<double, std::nano>(time_batch(iterations));
+                samples.push_back(elapsed.count() / iterations);
+            }
+
+            Result result{std::string(name), iterations, Statistics::from(std::move(samples)), std::nullopt};
+
+            if (options_.hardware_counters && counters_.available())
+            {
+                counters_.start();
+                time_batch(iterations);
+                if (auto counters = counters_.stop())
+                {
+                    result.counters_per_iteration = CounterValues{counters->cycles / iterations, counters->instructions / iterations,
+                        counters->cache_misses / iterations, counters->branch_misses / iterations};
+                }
+            }
+
+            report(result);
+            results_.push_back(result);
+
+            return result;
+        }
+
+        const std::vector<Result>& results() const
+        {
+            return results_;
+        }
+
+    private:
+        Options options_;
+        std::ostream& out_;
+        PerfCounters counters_;
+        std::vector<Result> results_;
+
+        void report(const Result& result)
+        {
+            const auto& stats = result.ns_per_iteration;
+
+            out_ << std::format("{:<48} {:>12.1f} ns  p99 {:>12.1f} ns  mad {:>9.1f} ns  ({} iters)", result.name, stats.median,
+                stats.p99, stats.mad, result.iterations_per_sample);
+
+            if (const auto& counters = result.counters_per_iteration)
+            {
+                out_ << std::format("  cycles {:.1f}  instr {:.1f}  cache-miss {:.2f}  branch-miss {:.2f}", counters->cycles,
+                    counters->instructions, counters->cache_misses, counters->branch_misses);
+            }
+
+            out_ << "\n";
+        }
+    };
+
+    using BenchmarkFunction = void (*)(Runner&);
+
+    struct RegisteredBenchmark
+    {
+        std::string_view name;
+        BenchmarkFunction function;
+    };
+
+    inline std::vector<RegisteredBenchmark>& registry()
+    {
+        static std::vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view name, BenchmarkFunction function)
+        {
+            registry().push_back({name, function});
+        }
+    };
+
+    // runs registered benchmarks whose names contain any of the filters (all when no filters are given)
+    inline int run_registered(const std::vector<std::string_view>& filters = {}, Options options = {})
+    {
+#if !defined(__OPTIMIZE__) && !defined(NDEBUG)
+        std::cout << "WARNING: benchmarks were built without optimizations\n";
+#endif
+
+        Runner runner{options};
+
+        for (const auto& benchmark : registry())
+        {
+            const bool selected = filters.empty()
+                || std::ranges::any_of(filters, [&](std::string_view filter) { return benchmark.name.find(filter) != std::string_view::npos; });
+
+            if (selected)
+            {
+                std::cout << "\n### " << benchmark.name << "\n";
+                benchmark.function(runner);
+            }
+        }
+
+        return 0;
+    }
+} // namespace helpers::benchmark
+
+#define HELPERS_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define HELPERS_BENCHMARK_CONCAT(a, b) HELPERS_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define HELPERS_BENCHMARK_IMPL(name, function)                                                          \
+    static void function(::helpers::benchmark::Runner& bench);                                          \
+    static const ::helpers::benchmark::Registrar HELPERS_BENCHMARK_CONCAT(function, _registrar){name, function}; \
+    static void function([[maybe_unused]] ::helpers::benchmark::Runner& bench)
+
+// HELPERS_BENCHMARK("name") { bench.run("case", [&] { ... }); }
+#define HELPERS_BENCHMARK(name) HELPERS_BENCHMARK_IMPL(name, HELPERS_BENCHMARK_CONCAT(helpers_benchmark_, __LINE__))
+
+#endif
@@ -0,0 +1,12 @@
+#include "benchmark.hpp"
+
+#include <string_view>
+#include <vector>
+
+// usage: bench-<dir> [filter...] - runs benchmarks whose names contain any of the filters
+int main(int argc, char* argv[])
+{
+    std::vector<std::string_view> filters(argv + 1, argv + argc);
+
+    return helpers::benchmark::run_registered(filters);
+}
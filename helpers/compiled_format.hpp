@@ -0,0 +1,230 @@
+#ifndef COMPILED_FORMAT_HPP
+#define COMPILED_FORMAT_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace helpers
+{
+    template <size_t N>
+    struct FixedString
+    {
+        char value[N];
+
+        constexpr FixedString(const char (&str)[N])
+        {
+            std::copy(str, str + N, value);
+        }
+
+        constexpr std::string_view view() const
+        {
+            return {value, N - 1};
+        }
+    };
+
+    namespace format_details
+    {
+        struct Segment
+        {
+            size_t offset = 0;
+            size_t length = 0;
+            bool is_argument = false;
+        };
+
+        // calls visitor(literal_text) and visitor(argument_placeholder) - only "{}" and "{{", "}}" escapes are supported
+        template <typename TVisitor>
+        constexpr void parse(std::string_view fmt, TVisitor visitor)
+        {
+            size_t literal_start = 0;
+            for (size_t pos = 0; pos < fmt.size(); ++pos)
+            {
+                if (fmt[pos] == '{' || fmt[pos] == '}')
+                {
+                    const bool escaped = pos + 1 < fmt.size() && fmt[pos + 1] == fmt[pos];
+                    const bool placeholder = fmt[pos] == '{' && pos + 1 < fmt.size() && fmt[pos + 1] == '}';
+
+                    if (!escaped && !placeholder)
+                        throw std::invalid_argument("only {} placeholders are supported");
+
+                    visitor(Segment{literal_start, pos - literal_start + (escaped ? 1 : 0), false});
+                    if (placeholder)
+                        visitor(Segment{pos, 2, true});
+
+                    ++pos;
+                    literal_start = pos + 1;
+                }
+            }
+            visitor(Segment{literal_start, fmt.size() - literal_start, false});
+        }
+
+        // writes into a caller buffer; counts the full size even when the buffer is too small
+        class BufferWriter
+        {
+        public:
+            explicit BufferWriter(std::span<char> buffer)
+                : buffer_{buffer}
+            {
+            }
+
+            void write(std::string_view text)
+            {
+                if (size_ < buffer_.size())
+                    std::copy_n(text.data(), std::min(text.size(), buffer_.size() - size_), buffer_.data() + size_);
+                size_ += text.size();
+            }
+
+            template <typename T>
+                requires std::is_arithmetic_v<T>
+            void write_number(T value)
+            {
+                char digits[64];
+                auto [end, ec] = std::to_chars(std::begin(digits), std::end(digits), value);
+                const size_t length = std::min(static_cast<size_t>(end - digits), sizeof(digits)); // bounded copy for the optimizer
+                write(std::string_view{digits, length});
+            }
+
+            template <typename T>
+            void write_formatted(const T& value)
+            {
+                const size_t position = std::min(size_, buffer_.size());
+                size_ += std::format_to_n(buffer_.data() + position, buffer_.size() - position, "{}", value).size;
+            }
+
+            size_t size() const
+            {
+                return size_;
+            }
+
+        private:
+            std::span<char> buffer_;
+            size_t size_ = 0;
+        };
+
+        template <typename T>
+        void write_argument(BufferWriter& out, const T& arg)
+        {
+            if constexpr (std::same_as<T, bool>)
+                out.write(arg ? "true" : "false");
+            else if constexpr (std::same_as<T, char>)
+                out.write(std::string_view{&arg, 1});
+            else if constexpr (std::is_arithmetic_v<T>)
+                out.write_number(arg);
+            else if constexpr (std::convertible_to<const T&, std::string_view>)
+                out.write(std::string_view{arg});
+            else
+                out.write_formatted(arg);
+        }
+    } // namespace format_details
+
+    // format string parsed at compile time into literal and argument segments;
+    // formatting is a sequence of copies and to_chars calls - no parsing and no type erasure at runtime
+    template <FixedString Fmt>
+    struct fmt_string
+    {
+        static constexpr std::string_view text = Fmt.view();
+
+        static constexpr size_t segment_count = [] {
+            size_t count = 0;
+            format_details::parse(text, [&](format_details::Segment) { ++count; });
+            return count;
+        }();
+
+        static constexpr auto segments = [] {
+            std::array<format_details::Segment, segment_count> result{};
+            size_t index = 0;
+            format_details::parse(text, [&](format_details::Segment segment) { result[index++] = segment; });
+            return result;
+        }();
+
+        static constexpr size_t argument_count = std::ranges::count_if(segments, &format_details::Segment::is_argument);
+
+        // returns the size of the formatted text - output is truncated when it exceeds the buffer
+        template <typename... TArgs>
+        static size_t format_to(std::span<char> buffer, const TArgs&... args)
+        {
+            static_assert(sizeof...(TArgs) == argument_count, "number of arguments does not match the format string");
+
+            format_details::BufferWriter out{buffer};
+            write_segments(out, std::forward_as_tuple(args...), std::make_index_sequence<segment_count>{});
+            return out.size();
+        }
+
+        template <typename... TArgs>
+        static std::string format(const TArgs&... args)
+        {
+            char stack_buffer[256];
+            const size_t size = format_to(stack_buffer, args...);
+            if (size <= sizeof(stack_buffer))
+                return std::string(stack_buffer, size);
+
+            std::string result(size, '\0');
+            format_to(result, args...);
+            return result;
+        }
+
+        // like print() from ex-compare: formatted text followed by a new line
+        template <typename... TArgs>
+        static void print(std::FILE* file, const TArgs&... args)
+        {
+            char stack_buffer[512];
+            const size_t size = format_to(std::span{stack_buffer}.first(sizeof(stack_buffer) - 1), args...);
+            if (size < sizeof(stack_buffer))
+            {
+                stack_buffer[size] = '\n';
+                std::fwrite(stack_buffer, 1, size + 1, file);
+                return;
+            }
+
+            std::string text = format(args...);
+            text.push_back('\n');
+            std::fwrite(text.data(), 1, text.size(), file);
+        }
+
+    private:
+        template <size_t Index>
+        static constexpr size_t argument_index()
+        {
+            size_t index = 0;
+            for (size_t i = 0; i < Index; ++i)
+                index += segments[i].is_argument;
+            return index;
+        }
+
+        template <typename TTuple, size_t... Is>
+        static void write_segments(format_details::BufferWriter& out, const TTuple& args, std::index_sequence<Is...>)
+        {
+            (write_segment<Is>(out, args), ...);
+        }
+
+        template <size_t Index, typename TTuple>
+        static void write_segment(format_details::BufferWriter& out, const TTuple& args)
+        {
+            constexpr auto segment = segments[Index];
+
+            if constexpr (segment.is_argument)
+                format_details::write_argument(out, std::get<argument_index<Index>()>(args));
+            else if constexpr (segment.length > 0)
+                out.write(text.substr(segment.offset, segment.length));
+        }
+    };
+
+    template <FixedString Fmt, typename... TArgs>
+    std::string format(const TArgs&... args)
+    {
+        return fmt_string<Fmt>::format(args...);
+    }
+} // namespace helpers
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef DATASETS_HPP
+#define DATASETS_HPP
+
+#include "random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helpers
+{
+    enum class Distribution { uniform, sorted, reverse_sorted, organ_pipe, sawtooth, few_unique, zipf, normal };
+
+    inline constexpr std::array all_distributions = {
+        Distribution::uniform, Distribution::sorted, Distribution::reverse_sorted, Distribution::organ_pipe,
+        Distribution::sawtooth, Distribution::few_unique, Distribution::zipf, Distribution::normal};
+
+    constexpr std::string_view to_string(Distribution distribution)
+    {
+        switch (distribution)
+        {
+            case Distribution::uniform:
+                return "uniform";
+            case Distribution::sorted:
+                return "sorted";
+            case Distribution::reverse_sorted:
+                return "reverse_sorted";
+            case Distribution::organ_pipe:
+                return "organ_pipe";
+            case Distribution::sawtooth:
+                return "sawtooth";
+            case Distribution::few_unique:
+                return "few_unique";
+            case Distribution::zipf:
+                return "zipf";
+            case Distribution::normal:
+                return "normal";
+        }
+        return "unknown";
+    }
+
+    // all values are generated in [low, high) - low < high, otherwise generate_dataset() throws
+    struct DatasetOptions
+    {
+        int low = -100;
+        int high = 100;
+        size_t unique_values = 8;   // few_unique
+        size_t sawtooth_period = 64; // sawtooth
+        unsigned zipf_exponent = 1;  // zipf: P(k) ~ 1 / k^s, integral s keeps it constexpr
+    };
+
+    namespace details
+    {
+        constexpr int scale_to_range(size_t pos, size_t length, const DatasetOptions& options)
+        {
+            const auto width = static_cast<uint64_t>(options.high - options.low);
+            return options.low + static_cast<int>((pos * width) / std::max<size_t>(length, 1));
+        }
+
+        constexpr int uniform_value(random::PCG& rnd, const DatasetOptions& options)
+        {
+            return options.low + static_cast<int>(random::bounded(rnd, options.high - options.low));
+        }
+
+        // Irwin-Hall approximation: sum of 12 uniforms has mean 6 and variance 1
+        constexpr int normal_value(random::PCG& rnd, const DatasetOptions& options)
+        {
+            double sum = 0.0;
+            for (int i = 0; i < 12; ++i)
+                sum += random::to_unit_float(rnd());
+
+            const double mean = (options.low + options.high) / 2.0;
+            const double stddev = (options.high - options.low) / 6.0;
+            const double value = mean + (sum - 6.0) * stddev;
+
+            auto floor_value = static_cast<int>(value);
+            if (floor_value > value)
+                --floor_value;
+
+            return std::clamp(floor_value, options.low, options.high - 1);
+        }
+
+        constexpr void generate_zipf(std::span<int> data, random::PCG& rnd, const DatasetOptions& options)
+        {
+            const size_t ranks = options.high - options.low;
+
+            std::vector<double> cumulative_weights(ranks);
+            double total = 0.0;
+            for (size_t rank = 1; rank <= ranks; ++rank)
+            {
+                double power = 1.0;
+                for (unsigned i = 0; i < options.zipf_exponent; ++i)
+                    power *= static_cast<double>(rank);
+
+                total += 1.0 / power;
+                cumulative_weights[rank - 1] = total;
+            }
+
+            for (auto& item : data)
+            {
+                const double u = random::to_unit_float(rnd()) * total;
+                auto pos = std::ranges::upper_bound(cumulative_weights, u);
+                const auto rank = std::min<size_t>(pos - cumulative_weights.begin(), ranks - 1);
+                item = options.low + static_cast<int>(rank);
+            }
+        }
+    } // namespace details
+
+    // fills data with the named distribution - the same seed gives the same data at compile time and at runtime
+    constexpr void generate_dataset(std::span<int> data, Distribution distribution, uint32_t seed = 42, DatasetOptions options = {})
+    {
+        if (options.low >= options.high)
+            throw std::invalid_argument("dataset range must not be empty - low must be less than high");
+
+        random::PCG rnd{seed};
+
+        switch (distribution)
+        {
+            case Distribution::uniform:
+                std::ranges::generate(data, [&] { return details::uniform_value(rnd, options); });
+                break;
+            case Distribution::sorted:
+                std::ranges::generate(data, [&] { return details::uniform_value(rnd, options); });
+                std::ranges::sort(data);
+                break;
+            case Distribution::reverse_sorted:
+                std::ranges::generate(data, [&] { return details::uniform_value(rnd, options); });
+                std::ranges::sort(data, std::greater{});
+                break;
+            case Distribution::organ_pipe:
+            {
+                const size_t half = (data.size() + 1) / 2;
+                for (size_t i = 0; i < data.size(); ++i)
+                    data[i] = details::scale_to_range(i < half ? i : data.size() - 1 - i, half, options);
+                break;
+            }
+            case Distribution::sawtooth:
+                if (options.sawtooth_period == 0)
+                    throw std::invalid_argument("sawtooth period must be positive");
+                for (size_t i = 0; i < data.size(); ++i)
+                    data[i] = details::scale_to_range(i % options.sawtooth_period, options.sawtooth_period, options);
+                break;
+            case Distribution::few_unique:
+            {
+                std::vector<int> pool(std::max<size_t>(options.unique_values, 1));
+                std::ranges::generate(pool, [&] { return details::uniform_value(rnd, options); });
+                std::ranges::generate(data, [&] { return pool[random::bounded(rnd, pool.size())]; });
+                break;
+            }
+            case Distribution::zipf:
+                details::generate_zipf(data, rnd, options);
+                break;
+            case Distribution::normal:
+                std::ranges::generate(data, [&] { return details::normal_value(rnd, options); });
+                break;
+        }
+    }
+
+    template <size_t Size>
+    [[nodiscard]] constexpr std::array<int, Size> create_dataset(Distribution distribution, uint32_t seed = 42, DatasetOptions options = {})
+    {
+        std::array<int, Size> data{};
+        generate_dataset(data, distribution, seed, options);
+        return data;
+    }
+
+    [[nodiscard]] inline std::vector<int> create_dataset(Distribution distribution, size_t size, uint32_t seed = 42, DatasetOptions options = {})
+    {
+        std::vector<int> data(size);
+        generate_dataset(data, distribution, seed, options);
+        return data;
+    }
+
+    inline constexpr std::string_view lowercase_alphabet = "abcdefghijklmnopqrstuvwxyz";
+
+    constexpr void generate_random_string(std::span<char> str, random::PCG& rnd, std::string_view alphabet = lowercase_alphabet)
+    {
+        std::ranges::generate(str, [&] { return alphabet[random::bounded(rnd, alphabet.size())]; });
+    }
+
+    // compile-time friendly: Size strings of exactly Length characters (not null-terminated)
+    template <size_t Size, size_t Length>
+    [[nodiscard]] constexpr auto create_string_dataset(uint32_t seed = 42, std::string_view alphabet = lowercase_alphabet)
+    {
+        random::PCG rnd{seed};
+
+        std::array<std::array<char, Length>, Size> data{};
+        for (auto& str : data)
+            generate_random_string(str, rnd, alphabet);
+
+        return data;
+    }
+
+    // strings with length drawn uniformly from [min_length, max_length]
+    [[nodiscard]] inline std::vector<std::string> create_string_dataset(size_t size, size_t min_length, size_t max_length,
+        uint32_t seed = 42, std::string_view alphabet = lowercase_alphabet)
+    {
+        random::PCG rnd{seed};
+
+        std::vector<std::string> data(size);
+        for (auto& str : data)
+        {
+            str.resize(min_length + random::bounded(rnd, max_length - min_length + 1));
+            generate_random_string(str, rnd, alphabet);
+        }
+
+        return data;
+    }
+} // namespace helpers
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef FILL_HPP
+#define FILL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HELPERS_FILL_X86_STREAMING 1
+#include <emmintrin.h>
+#endif
+
+namespace helpers
+{
+    namespace fill_details
+    {
+        inline size_t detect_last_level_cache_size()
+        {
+            long size = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+            size = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+            if (size <= 0)
+                size = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+            return size > 0 ? static_cast<size_t>(size) : 8 * 1024 * 1024;
+        }
+    } // namespace fill_details
+
+    // detected on first use - safe to call from static initializers of other translation units
+    inline size_t last_level_cache_size()
+    {
+        static const size_t size = fill_details::detect_last_level_cache_size();
+        return size;
+    }
+
+    struct FillOptions
+    {
+        size_t streaming_threshold = last_level_cache_size(); // bytes - larger fills bypass the cache
+        size_t max_threads = 1;
+        size_t min_bytes_per_thread = 16 * 1024 * 1024;
+    };
+
+    namespace fill_details
+    {
+        constexpr size_t vector_size = 16;
+
+        template <typename T>
+        concept BroadcastFillable = std::is_trivially_copyable_v<T> && (vector_size % sizeof(T) == 0);
+
+        template <typename T>
+        bool is_byte_repeating(const T& value)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+            return std::all_of(bytes, bytes + sizeof(T), [&](unsigned char b) { return b == bytes[0]; });
+        }
+
+        // pattern[i] == object representation of value repeated, starting at byte phase
+        template <typename T>
+        std::array<unsigned char, 2 * vector_size> make_pattern(const T& value, size_t phase)
+        {
+            std::array<unsigned char, 2 * vector_size> pattern;
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+            for (size_t i = 0; i < pattern.size(); ++i)
+                pattern[i] = bytes[(phase + i) % sizeof(T)];
+            return pattern;
+        }
+
+        // bytes of [first, first + size) get value's representation repeated; size is a multiple of sizeof(T)
+        template <typename T>
+        void broadcast_fill(unsigned char* first, size_t size, const T& value, bool streaming)
+        {
+            const auto head_pattern = make_pattern(value, 0);
+
+            // head - up to the first 16-byte aligned address
+            const size_t head = std::min(size, (vector_size - reinterpret_cast<std::uintptr_t>(first) % vector_size) % vector_size);
+            std::memcpy(first, head_pattern.data(), head);
+
+            const auto pattern = make_pattern(value, head % sizeof(T));
+            unsigned char* out = first + head;
+            unsigned char* const last = first + size;
+
+#ifdef HELPERS_FILL_X86_STREAMING
+            const __m128i broadcast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.data()));
+            if (streaming)
+            {
+                for (; out + 4 * vector_size <= last; out += 4 * vector_size)
+                {
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(out), broadcast);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(out + vector_size), broadcast);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(out + 2 * vector_size), broadcast);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(out + 3 * vector_size), broadcast);
+                }
+                _mm_sfence(); // streaming stores are weakly ordered
+            }
+
+            for (; out + vector_size <= last; out += vector_size)
+                _mm_store_si128(reinterpret_cast<__m128i*>(out), broadcast);
+#else
+            (void)streaming;
+            for (; out + vector_size <= last; out += vector_size)
+                std::memcpy(out, pattern.data(), vector_size);
+#endif
+
+            // tail - fewer than 16 bytes, phase is the same as for the aligned part
+            std::memcpy(out, pattern.data(), static_cast<size_t>(last - out));
+        }
+
+        template <typename T>
+        void fill_chunk(std::span<T> data, const T& value, bool streaming)
+        {
+            if constexpr (!std::is_trivially_copyable_v<T>)
+            {
+                std::fill(data.begin(), data.end(), value);
+            }
+            else
+            {
+                auto* first = reinterpret_cast<unsigned char*>(data.data());
+
+                if (is_byte_repeating(value))
+                {
+                    const auto byte = reinterpret_cast<const unsigned char&>(value);
+                    if (streaming)
+                        broadcast_fill(first, data.size_bytes(), byte, true);
+                    else
+                        std::memset(first, byte, data.size_bytes());
+                }
+                else if constexpr (BroadcastFillable<T>)
+                    broadcast_fill(first, data.size_bytes(), value, streaming);
+                else
+                    std::fill(data.begin(), data.end(), value);
+            }
+        }
+    } // namespace fill_details
+
+    // std::fill for spans:
+    //  * memset when every byte of value is the same (0, -1, 0x0101...),
+    //  * 16-byte broadcast stores for other values of 1, 2, 4, 8 or 16 byte types,
+    //  * streaming (non-temporal) stores beyond options.streaming_threshold - a huge fill does not evict the working set,
+    //  * optionally split between threads (each thread gets at least options.min_bytes_per_thread)
+    template <typename T>
+    void fill(std::span<T> data, const std::type_identity_t<T>& value, const FillOptions& options = {})
+    {
+        if (data.empty())
+            return;
+
+        const bool streaming = data.size_bytes() > options.streaming_threshold;
+
+        const size_t thread_count = std::clamp<size_t>(data.size_bytes() / std::max<size_t>(options.min_bytes_per_thread, 1), 1,
+            std::max<size_t>(options.max_threads, 1));
+
+        if (thread_count == 1)
+        {
+            fill_details::fill_chunk(data, value, streaming);
+            return;
+        }
+
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count - 1);
+        for (size_t i = 1; i < thread_count; ++i)
+        {
+            const size_t first = data.size() * i / thread_count;
+            const size_t last = data.size() * (i + 1) / thread_count;
+            workers.emplace_back([=, &value] { fill_details::fill_chunk(data.subspan(first, last - first), value, streaming); });
+        }
+
+        fill_details::fill_chunk(data.first(data.size() / thread_count), value, streaming);
+    }
+} // namespace helpers
+
+#endif
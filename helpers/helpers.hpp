@@ -1,6 +1,8 @@
 #ifndef HELPERS_HPP
 #define HELPERS_HPP
 
+#include "datasets.hpp"
+#include "output.hpp"
 #include "random.hpp"
 
 #include <iostream>
@@ -10,55 +12,53 @@
 #include <utility>
 #include <cstdint>
 #include <array>
+#include <limits>
+#include <string_view>
+#include <vector>
 
 namespace helpers
 {
     template <typename T>
     concept PrintableRange = std::ranges::range<T> && requires(std::ranges::range_value_t<T>&& item) { std::cout << item; };
 
-    void print(PrintableRange auto&& rng, std::string_view prefix = "rng")
+    struct PrintOptions
     {
-        std::cout << prefix << " = [";
+        size_t max_items = std::numeric_limits<size_t>::max();
+        OutputSink sink = std::cout;
+    };
+
+    void print(PrintableRange auto&& rng, std::string_view prefix = "rng", PrintOptions options = {})
+    {
+        OutputBuffer out{options.sink};
+
+        out.append(prefix);
+        out.append(" = [");
+
+        size_t count = 0;
         for (const auto& item : rng)
         {
-            if constexpr (std::convertible_to<decltype(item), std::string_view>)
+            if (count++ == options.max_items)
             {
-                std::cout << '"' << item << '"' << " ";
-            }
-            else
-            {
-                std::cout << item << " ";
+                out.append("... ");
+                break;
             }
+
+            out.append_item(item);
+            out.append(' ');
         }
-        std::cout << "]\n";
+        out.append("]\n");
     }
 
     template <size_t Size>
     [[nodiscard]] constexpr auto create_numeric_dataset(uint32_t seed = 42, int low = -100, int high = 100)
     {
-        std::vector<int> data(Size);
-        data.reserve(Size);
-
-        auto uniform_distr = [low, high](auto&& rnd_gen) {
-            uint32_t width = high - low;
-            return (rnd_gen() % width) + low;
-        };
-
-        if (std::is_constant_evaluated())
-        {
-            random::PCG pcg_rnd{seed};
-
-            std::ranges::generate(data, [&] { return uniform_distr(pcg_rnd); });
-        }
-        else
-        {
-            // std::mt19937 mt_rnd{seed};
-
-            // std::ranges::generate(data, [&] { return uniform_distr(mt_rnd); });
-        }
+        // the same generator at compile time and at runtime - the same seed gives the same data
+        random::PCGBatch<> pcg_batch_rnd{seed};
+        std::vector<uint32_t> offsets(Size);
+        pcg_batch_rnd.fill_bounded(offsets, static_cast<uint32_t>(high - low));
 
         std::array<int, Size> result_data{};
-        std::ranges::copy(data, result_data.begin());
+        std::ranges::transform(offsets, result_data.begin(), [low](uint32_t offset) { return static_cast<int>(offset) + low; });
 
         return result_data;
     }
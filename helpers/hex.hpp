@@ -0,0 +1,317 @@
+#ifndef HEX_HPP
+#define HEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HELPERS_HEX_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace helpers::hex
+{
+    enum class Case
+    {
+        lower,
+        upper
+    };
+
+    namespace details
+    {
+        constexpr std::string_view lower_digits = "0123456789abcdef";
+        constexpr std::string_view upper_digits = "0123456789ABCDEF";
+
+        // 256 entries x 2 chars - one load per byte
+        constexpr auto make_encode_table(std::string_view digits)
+        {
+            std::array<char, 512> table{};
+            for (size_t byte = 0; byte < 256; ++byte)
+            {
+                table[2 * byte] = digits[byte >> 4];
+                table[2 * byte + 1] = digits[byte & 0x0F];
+            }
+            return table;
+        }
+
+        inline constexpr auto lower_table = make_encode_table(lower_digits);
+        inline constexpr auto upper_table = make_encode_table(upper_digits);
+
+        constexpr std::uint8_t invalid = 0xFF;
+
+        inline constexpr auto decode_table = [] {
+            std::array<std::uint8_t, 256> table{};
+            for (size_t c = 0; c < 256; ++c)
+            {
+                if (c >= '0' && c <= '9')
+                    table[c] = static_cast<std::uint8_t>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    table[c] = static_cast<std::uint8_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    table[c] = static_cast<std::uint8_t>(c - 'A' + 10);
+                else
+                    table[c] = invalid;
+            }
+            return table;
+        }();
+
+        inline void encode_scalar(const std::uint8_t* in, size_t size, char* out, Case letter_case)
+        {
+            const char* table = (letter_case == Case::upper ? upper_table : lower_table).data();
+            for (size_t i = 0; i < size; ++i)
+                std::memcpy(out + 2 * i, table + 2 * in[i], 2);
+        }
+
+        // false for invalid characters - out is then unspecified
+        inline bool decode_scalar(const char* in, size_t size, std::uint8_t* out)
+        {
+            std::uint8_t errors = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const std::uint8_t high = decode_table[static_cast<unsigned char>(in[2 * i])];
+                const std::uint8_t low = decode_table[static_cast<unsigned char>(in[2 * i + 1])];
+                errors |= (high | low) & 0xF0u;
+                out[i] = static_cast<std::uint8_t>((high << 4) | (low & 0x0Fu));
+            }
+            return errors == 0;
+        }
+
+#ifdef HELPERS_HEX_X86_KERNELS
+        // nibbles are indexes into a 16-entry digit table - pshufb translates 32 of them at once
+        __attribute__((target("avx2"))) inline void encode_avx2(const std::uint8_t* in, size_t size, char* out, Case letter_case)
+        {
+            const auto* digits = (letter_case == Case::upper ? upper_digits : lower_digits).data();
+            const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+            size_t i = 0;
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                const __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble_mask));
+                const __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, nibble_mask));
+
+                // unpack interleaves within 128-bit lanes - permute restores the byte order
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+
+            encode_scalar(in + i, size - i, out + 2 * i, letter_case);
+        }
+
+        __attribute__((target("ssse3"))) inline void encode_ssse3(const std::uint8_t* in, size_t size, char* out, Case letter_case)
+        {
+            const auto* digits = (letter_case == Case::upper ? upper_digits : lower_digits).data();
+            const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask));
+                const __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(bytes, nibble_mask));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+            }
+
+            encode_scalar(in + i, size - i, out + 2 * i, letter_case);
+        }
+
+        // 16 chars -> 16 nibbles; invalid characters clear bits in valid_mask
+        __attribute__((target("ssse3"))) inline __m128i decode_nibbles_ssse3(__m128i chars, int& valid_mask)
+        {
+            const __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20)); // 'A'-'F' -> 'a'-'f'
+
+            // signed compares - bytes >= 0x80 are negative and fail both ranges
+            const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+            const __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(folded, _mm_set1_epi8('f' + 1)));
+
+            valid_mask &= _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+
+            return _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                _mm_and_si128(is_letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+        }
+
+        __attribute__((target("ssse3"))) inline bool decode_ssse3(const char* in, size_t size, std::uint8_t* out)
+        {
+            const __m128i weights = _mm_set1_epi16(0x0110); // high nibble * 16 + low nibble * 1
+
+            int valid_mask = 0xFFFF;
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i first = decode_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i)), valid_mask);
+                const __m128i second = decode_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i + 16)), valid_mask);
+
+                const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), bytes);
+            }
+
+            return valid_mask == 0xFFFF && decode_scalar(in + 2 * i, size - i, out + i);
+        }
+#endif
+
+        struct Kernels
+        {
+            void (*encode)(const std::uint8_t*, size_t, char*, Case) = encode_scalar;
+            bool (*decode)(const char*, size_t, std::uint8_t*) = decode_scalar;
+        };
+
+        inline Kernels select_kernels()
+        {
+            Kernels kernels;
+#ifdef HELPERS_HEX_X86_KERNELS
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("ssse3"))
+            {
+                kernels.encode = encode_ssse3;
+                kernels.decode = decode_ssse3;
+            }
+            if (__builtin_cpu_supports("avx2"))
+                kernels.encode = encode_avx2;
+#endif
+            return kernels;
+        }
+
+        // function-local static - initialized on first use, also from static initializers in other translation units
+        inline const Kernels& active_kernels()
+        {
+            static const Kernels kernels = select_kernels(); // dispatch decided once
+            return kernels;
+        }
+    } // namespace details
+
+    constexpr size_t encoded_size(size_t byte_count)
+    {
+        return 2 * byte_count;
+    }
+
+    // writes 2 * bytes.size() chars to out; returns number of written chars
+    inline size_t encode(std::span<const std::byte> bytes, std::span<char> out, Case letter_case = Case::upper)
+    {
+        if (out.size() < encoded_size(bytes.size()))
+            throw std::length_error("output buffer too small for hex encoding");
+
+        details::active_kernels().encode(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size(), out.data(), letter_case);
+        return encoded_size(bytes.size());
+    }
+
+    inline std::string encode(std::span<const std::byte> bytes, Case letter_case = Case::upper)
+    {
+        std::string result(encoded_size(bytes.size()), '\0');
+        encode(bytes, result, letter_case);
+        return result;
+    }
+
+    // returns number of decoded bytes or std::nullopt for odd length, invalid characters or a too small buffer
+    inline std::optional<size_t> decode(std::string_view hex, std::span<std::byte> out)
+    {
+        if (hex.size() % 2 != 0 || out.size() < hex.size() / 2)
+            return std::nullopt;
+
+        if (!details::active_kernels().decode(hex.data(), hex.size() / 2, reinterpret_cast<std::uint8_t*>(out.data())))
+            return std::nullopt;
+
+        return hex.size() / 2;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // xxd-style dump: "00000000: 4865 6c6c 6f20 576f 726c 640a            Hello World."
+
+    struct XxdOptions
+    {
+        size_t columns = 16;   // bytes per line
+        size_t group_size = 2; // bytes per space-separated group
+        Case letter_case = Case::lower;
+        size_t start_offset = 0;
+    };
+
+    namespace details
+    {
+        inline constexpr auto printable_table = [] {
+            std::array<char, 256> table{};
+            for (size_t c = 0; c < 256; ++c)
+                table[c] = (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '.';
+            return table;
+        }();
+
+        constexpr size_t xxd_hex_width(const XxdOptions& options)
+        {
+            return 2 * options.columns + (options.columns + options.group_size - 1) / options.group_size;
+        }
+
+        constexpr size_t xxd_line_size(const XxdOptions& options)
+        {
+            return 10 + xxd_hex_width(options) + 1 + options.columns + 1; // "offset: " hex " " ascii "\n"
+        }
+    } // namespace details
+
+    // upper bound of the dump size - the last line is shorter
+    constexpr size_t xxd_size(size_t byte_count, const XxdOptions& options = {})
+    {
+        return (byte_count + options.columns - 1) / options.columns * details::xxd_line_size(options);
+    }
+
+    // returns number of written chars; out must hold at least xxd_size(bytes.size(), options) chars
+    inline size_t xxd(std::span<const std::byte> bytes, std::span<char> out, const XxdOptions& options = {})
+    {
+        if (options.columns == 0 || options.group_size == 0)
+            throw std::invalid_argument("columns and group size must be positive");
+        if (out.size() < xxd_size(bytes.size(), options))
+            throw std::length_error("output buffer too small for hex dump");
+
+        const char* table = (options.letter_case == Case::upper ? details::upper_table : details::lower_table).data();
+        const size_t hex_width = details::xxd_hex_width(options);
+
+        char* pos = out.data();
+        for (size_t line = 0; line < bytes.size(); line += options.columns)
+        {
+            const size_t offset = options.start_offset + line;
+            for (int shift = 28; shift >= 0; shift -= 4)
+                *pos++ = table[2 * ((offset >> shift) & 0x0F) + 1];
+            *pos++ = ':';
+            *pos++ = ' ';
+
+            const auto chunk = bytes.subspan(line, std::min(options.columns, bytes.size() - line));
+
+            char* hex_start = pos;
+            for (size_t group = 0; group < chunk.size(); group += options.group_size)
+            {
+                const size_t group_end = std::min(group + options.group_size, chunk.size());
+                for (size_t i = group; i < group_end; ++i, pos += 2)
+                    std::memcpy(pos, table + 2 * std::to_integer<size_t>(chunk[i]), 2);
+                if (group + options.group_size < options.columns)
+                    *pos++ = ' ';
+            }
+            std::memset(pos, ' ', hex_width - static_cast<size_t>(pos - hex_start) + 1);
+            pos = hex_start + hex_width + 1;
+
+            for (std::byte b : chunk)
+                *pos++ = details::printable_table[std::to_integer<size_t>(b)];
+            *pos++ = '\n';
+        }
+
+        return static_cast<size_t>(pos - out.data());
+    }
+
+    inline std::string xxd(std::span<const std::byte> bytes, const XxdOptions& options = {})
+    {
+        std::string result(xxd_size(bytes.size(), options), '\0');
+        result.resize(xxd(bytes, result, options));
+        return result;
+    }
+} // namespace helpers::hex
+
+#endif
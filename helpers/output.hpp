@@ -0,0 +1,222 @@
+#ifndef OUTPUT_HPP
+#define OUTPUT_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace helpers
+{
+    template <typename T>
+    concept Formattable = std::semiregular<std::formatter<std::remove_cvref_t<T>, char>>;
+
+    // destination of formatted output: std::ostream, FILE* or a raw file descriptor
+    class OutputSink
+    {
+        struct FileDescriptor
+        {
+            int fd;
+        };
+
+        std::variant<std::ostream*, std::FILE*, FileDescriptor> target_;
+
+        explicit OutputSink(FileDescriptor fd)
+            : target_{fd}
+        {
+        }
+
+    public:
+        OutputSink(std::ostream& out)
+            : target_{&out}
+        {
+        }
+
+        OutputSink(std::FILE* file)
+            : target_{file}
+        {
+        }
+
+        static OutputSink from_fd(int fd)
+        {
+            return OutputSink{FileDescriptor{fd}};
+        }
+
+        void write(std::string_view bytes) const
+        {
+            if (auto out = std::get_if<std::ostream*>(&target_))
+            {
+                (*out)->write(bytes.data(), bytes.size());
+            }
+            else if (auto file = std::get_if<std::FILE*>(&target_))
+            {
+                std::fwrite(bytes.data(), 1, bytes.size(), *file);
+            }
+            else
+            {
+                write_to_fd(std::get<FileDescriptor>(target_).fd, bytes);
+            }
+        }
+
+        void flush() const
+        {
+            if (auto out = std::get_if<std::ostream*>(&target_))
+                (*out)->flush();
+            else if (auto file = std::get_if<std::FILE*>(&target_))
+                std::fflush(*file);
+        }
+
+    private:
+        static void write_to_fd(int fd, std::string_view bytes)
+        {
+            while (!bytes.empty())
+            {
+#ifdef _WIN32
+                auto written = ::_write(fd, bytes.data(), static_cast<unsigned int>(bytes.size()));
+#else
+                auto written = ::write(fd, bytes.data(), bytes.size());
+#endif
+                if (written <= 0)
+                    return;
+                bytes.remove_prefix(static_cast<size_t>(written));
+            }
+        }
+    };
+
+    // renders items into a reusable per-thread buffer and hands it to the sink in large chunks;
+    // a nested OutputBuffer on the same thread (e.g. print() called from operator<<) gets its own buffer
+    class OutputBuffer
+    {
+    public:
+        static constexpr size_t flush_threshold = 64 * 1024;
+
+        explicit OutputBuffer(OutputSink sink)
+            : sink_{sink}
+            , borrowed_{borrow_thread_buffer()}
+            , buffer_{borrowed_ ? borrowed_->storage : own_buffer_}
+        {
+            buffer_.clear();
+        }
+
+        OutputBuffer(const OutputBuffer&) = delete;
+        OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+        ~OutputBuffer()
+        {
+            flush();
+            if (borrowed_)
+                borrowed_->in_use = false;
+        }
+
+        void append(char c)
+        {
+            buffer_.push_back(c);
+            flush_if_full();
+        }
+
+        void append(std::string_view text)
+        {
+            buffer_.append(text);
+            flush_if_full();
+        }
+
+        template <typename T>
+        void append_item(const T& item)
+        {
+            if constexpr (std::convertible_to<const T&, std::string_view>)
+            {
+                append('"');
+                append(std::string_view{item});
+                append('"');
+            }
+            else if constexpr (std::same_as<T, char> || std::same_as<T, signed char> || std::same_as<T, unsigned char>)
+            {
+                append(static_cast<char>(item)); // like operator<< - int8_t and uint8_t are characters
+            }
+            else if constexpr (std::same_as<T, bool>)
+            {
+                append(item ? '1' : '0');
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                char digits[64];
+                std::to_chars_result result;
+                if constexpr (std::is_floating_point_v<T>)
+                    result = std::to_chars(std::begin(digits), std::end(digits), item, std::chars_format::general, 6); // like operator<<
+                else
+                    result = std::to_chars(std::begin(digits), std::end(digits), item);
+                append(std::string_view{digits, std::min(static_cast<size_t>(result.ptr - digits), sizeof(digits))});
+            }
+            else if constexpr (Formattable<T>)
+            {
+                std::format_to(std::back_inserter(buffer_), "{}", item);
+                flush_if_full();
+            }
+            else
+            {
+                std::ostringstream out;
+                out << item;
+                append(std::move(out).str());
+            }
+        }
+
+        void flush()
+        {
+            if (!buffer_.empty())
+            {
+                sink_.write(buffer_);
+                buffer_.clear();
+            }
+        }
+
+    private:
+        struct ThreadBuffer
+        {
+            std::string storage;
+            bool in_use = false;
+        };
+
+        OutputSink sink_;
+        ThreadBuffer* borrowed_; // nullptr - the thread buffer is used by an enclosing OutputBuffer
+        std::string own_buffer_;
+        std::string& buffer_;
+
+        static ThreadBuffer* borrow_thread_buffer()
+        {
+            thread_local ThreadBuffer buffer = [] {
+                ThreadBuffer result;
+                result.storage.reserve(2 * flush_threshold);
+                return result;
+            }();
+
+            if (buffer.in_use)
+                return nullptr;
+
+            buffer.in_use = true;
+            return &buffer;
+        }
+
+        void flush_if_full()
+        {
+            if (buffer_.size() >= flush_threshold)
+                flush();
+        }
+    };
+} // namespace helpers
+
+#endif
@@ -2,8 +2,14 @@
 #define RANDOM_HPP
 
 #include <utility>
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstddef>
+#include <limits>
 #include <numeric>
+#include <span>
+#include <vector>
 
 namespace helpers::random
 {
@@ -19,15 +25,79 @@ namespace helpers::random
 
         using result_type = std::uint32_t;
 
+        static constexpr std::uint64_t multiplier = 6364126223846793005ULL;
+
         constexpr explicit PCG(std::uint64_t seed) : rng{.state=seed}
         {            
         }
 
+        // selects one of 2^63 independent streams (pcg32_srandom_r)
+        constexpr PCG(std::uint64_t seed, std::uint64_t stream) : rng{.state = 0u, .inc = (stream << 1u) | 1u}
+        {
+            pcg32_random_r();
+            rng.state += seed;
+            pcg32_random_r();
+        }
+
         constexpr result_type operator()()
         {
             return pcg32_random_r();
         }
 
+        // jump-ahead in O(log delta) - Brown, "Random Number Generation with Arbitrary Stride"
+        constexpr void advance(std::uint64_t delta)
+        {
+            std::uint64_t cur_mult = multiplier;
+            std::uint64_t cur_plus = increment();
+            std::uint64_t acc_mult = 1u;
+            std::uint64_t acc_plus = 0u;
+
+            while (delta > 0)
+            {
+                if (delta & 1u)
+                {
+                    acc_mult *= cur_mult;
+                    acc_plus = acc_plus * cur_mult + cur_plus;
+                }
+                cur_plus = (cur_mult + 1) * cur_plus;
+                cur_mult *= cur_mult;
+                delta >>= 1u;
+            }
+
+            rng.state = acc_mult * rng.state + acc_plus;
+        }
+
+        constexpr void discard(std::uint64_t n)
+        {
+            advance(n);
+        }
+
+        // splits the sequence into k non-overlapping blocks of 2^64 / k values - one per worker
+        constexpr std::vector<PCG> split(std::size_t k) const
+        {
+            std::vector<PCG> substreams;
+
+            if (k == 0)
+                return substreams;
+
+            const std::uint64_t block_size = std::numeric_limits<std::uint64_t>::max() / k;
+
+            substreams.reserve(k);
+            substreams.push_back(*this);
+            for (std::size_t i = 1; i < k; ++i)
+            {
+                substreams.push_back(substreams.back());
+                substreams.back().advance(block_size);
+            }
+
+            return substreams;
+        }
+
+        constexpr std::uint64_t stream() const
+        {
+            return rng.inc >> 1u;
+        }
+
         static constexpr result_type min()
         {
             return std::numeric_limits<result_type>::min();
@@ -38,19 +108,190 @@ namespace helpers::random
             return std::numeric_limits<result_type>::max();
         }
 
+        friend constexpr bool operator==(const PCG& lhs, const PCG& rhs)
+        {
+            return lhs.rng.state == rhs.rng.state && lhs.increment() == rhs.increment();
+        }
+
+        // output function (XSH RR)
+        static constexpr std::uint32_t output(std::uint64_t state)
+        {
+            std::uint32_t xor_shifted = ((state >> 18u) ^ state) >> 27u;
+            std::uint32_t rot = state >> 59u;
+
+            return (xor_shifted >> rot) | (xor_shifted << ((-rot) & 31));
+        }
+
+        constexpr std::uint64_t increment() const
+        {
+            return rng.inc | 1u;
+        }
+
     private:
         constexpr std::uint32_t pcg32_random_r()
         {
             std::uint64_t old_state = rng.state;
 
             // advance internal state
-            rng.state = old_state * 6364126223846793005ULL + (rng.inc | 1);
+            rng.state = old_state * multiplier + increment();
 
-            // calculate output function (XHS RR), uses old state for max ILP
-            std::uint32_t xor_shifted = ((old_state >> 18u) ^ old_state) >> 27u;
-            std::uint32_t rot = old_state >> 59u;
+            // calculate output function, uses old state for max ILP
+            return output(old_state);
+        }
+    };
 
-            return (xor_shifted >> rot) | (xor_shifted << ((-rot) & 31));
+    // Lemire's multiply-shift method - unbiased value in [0, range) without division on the fast path;
+    // range == 0 stands for 2^32 (high - low of the full uint32 range wraps to 0) - every value is returned as is
+    template <typename TGenerator>
+    constexpr std::uint32_t bounded(TGenerator& rnd_gen, std::uint32_t range)
+    {
+        if (range == 0)
+            return static_cast<std::uint32_t>(rnd_gen());
+
+        std::uint64_t m = static_cast<std::uint64_t>(rnd_gen()) * range;
+        auto low_bits = static_cast<std::uint32_t>(m);
+
+        if (low_bits < range)
+        {
+            const std::uint32_t threshold = -range % range;
+            while (low_bits < threshold)
+            {
+                m = static_cast<std::uint64_t>(rnd_gen()) * range;
+                low_bits = static_cast<std::uint32_t>(m);
+            }
+        }
+
+        return m >> 32u;
+    }
+
+    // 24 high bits mapped to [0, 1) - every result is exactly representable
+    constexpr float to_unit_float(std::uint32_t value)
+    {
+        return static_cast<float>(value >> 8u) * (1.0f / 16777216.0f);
+    }
+
+    // Lanes independent PCG streams stepped side by side; the state is kept as structure of arrays
+    // so that lane loops compile to AVX2/AVX-512 code (8/16 lanes) or plain scalar code otherwise
+    template <std::size_t Lanes = 8>
+    struct PCGBatch
+    {
+        static_assert(Lanes > 0);
+
+        using result_type = std::uint32_t;
+        using batch_type = std::array<result_type, Lanes>;
+
+        static constexpr std::size_t lanes = Lanes;
+
+        std::array<std::uint64_t, Lanes> state{};
+        std::array<std::uint64_t, Lanes> inc{};
+
+        // lane i produces the same sequence as PCG{seed, i}
+        constexpr explicit PCGBatch(std::uint64_t seed)
+        {
+            for (std::size_t lane = 0; lane < Lanes; ++lane)
+            {
+                PCG lane_rnd{seed, lane};
+                state[lane] = lane_rnd.rng.state;
+                inc[lane] = lane_rnd.increment();
+            }
+        }
+
+        constexpr batch_type operator()()
+        {
+            batch_type values{};
+            next(values.data());
+            return values;
+        }
+
+        constexpr void fill(std::span<result_type> out)
+        {
+            std::size_t pos = 0;
+            for (; pos + Lanes <= out.size(); pos += Lanes)
+                next(out.data() + pos);
+
+            fill_tail(out.subspan(pos), [](result_type value) { return value; });
+        }
+
+        // uniform floats in [0, 1)
+        constexpr void fill(std::span<float> out)
+        {
+            std::size_t pos = 0;
+            for (; pos + Lanes <= out.size(); pos += Lanes)
+            {
+                batch_type values{};
+                next(values.data());
+                for (std::size_t lane = 0; lane < Lanes; ++lane)
+                    out[pos + lane] = to_unit_float(values[lane]);
+            }
+
+            fill_tail(out.subspan(pos), to_unit_float);
+        }
+
+        // uniform values in [0, range) - Lemire's method, rejections are redrawn from the same lane; range == 0 stands for 2^32
+        constexpr void fill_bounded(std::span<result_type> out, result_type range)
+        {
+            if (range == 0)
+            {
+                fill(out);
+                return;
+            }
+
+            const result_type threshold = -range % range;
+
+            for (std::size_t pos = 0; pos < out.size(); pos += Lanes)
+            {
+                batch_type values{};
+                next(values.data());
+
+                std::array<std::uint64_t, Lanes> products{};
+                bool rejected = false;
+                for (std::size_t lane = 0; lane < Lanes; ++lane)
+                {
+                    products[lane] = static_cast<std::uint64_t>(values[lane]) * range;
+                    rejected |= static_cast<result_type>(products[lane]) < threshold;
+                }
+
+                if (rejected) [[unlikely]]
+                {
+                    for (std::size_t lane = 0; lane < Lanes; ++lane)
+                        while (static_cast<result_type>(products[lane]) < threshold)
+                            products[lane] = static_cast<std::uint64_t>(next(lane)) * range;
+                }
+
+                const std::size_t count = std::min(Lanes, out.size() - pos);
+                for (std::size_t lane = 0; lane < count; ++lane)
+                    out[pos + lane] = products[lane] >> 32u;
+            }
+        }
+
+    private:
+        constexpr void next(result_type* out)
+        {
+            for (std::size_t lane = 0; lane < Lanes; ++lane)
+            {
+                std::uint64_t old_state = state[lane];
+                state[lane] = old_state * PCG::multiplier + inc[lane];
+                out[lane] = PCG::output(old_state);
+            }
+        }
+
+        constexpr result_type next(std::size_t lane)
+        {
+            std::uint64_t old_state = state[lane];
+            state[lane] = old_state * PCG::multiplier + inc[lane];
+            return PCG::output(old_state);
+        }
+
+        template <typename T, typename TConvert>
+        constexpr void fill_tail(std::span<T> out, TConvert convert)
+        {
+            if (out.empty())
+                return;
+
+            batch_type values{};
+            next(values.data());
+            for (std::size_t i = 0; i < out.size(); ++i)
+                out[i] = convert(values[i]);
         }
     };
 } // namespace helpers::random
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <benchmark.hpp>
+#include <sstream>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("benchmark - statistics")
+{
+    auto stats = helpers::benchmark::Statistics::from({5.0, 1.0, 3.0, 2.0, 4.0, 100.0});
+
+    CHECK(stats.min == 1.0);
+    CHECK(stats.max == 100.0);
+    CHECK(stats.median == 3.5);
+    CHECK(stats.mean == 115.0 / 6);
+    CHECK(stats.p99 == 100.0);
+    CHECK(stats.mad == 1.5);
+
+    std::vector<double> latencies(1000, 10.0);
+    latencies.back() = 500.0;
+    latencies[0] = 90.0;
+    CHECK(helpers::benchmark::Statistics::from(latencies).p99 == 10.0);
+    CHECK(helpers::benchmark::Statistics::from(latencies).p999 == 90.0);
+}
+
+TEST_CASE("benchmark - do_not_optimize keeps the value")
+{
+    int count = 1'000'000;
+    helpers::benchmark::do_not_optimize(count);
+
+    auto sum_below = [&] {
+        long sum = 0;
+        for (int i = 0; i < count; ++i)
+            sum += i;
+        helpers::benchmark::do_not_optimize(sum);
+        return sum;
+    };
+
+    CHECK(sum_below() == 499'999'500'000L);
+    CHECK(count == 1'000'000);
+}
+
+TEST_CASE("benchmark - runner")
+{
+    std::ostringstream out;
+    helpers::benchmark::Runner runner{{.warmup_time = 1ms, .min_sample_time = 100us, .samples = 5, .hardware_counters = false}, out};
+
+    size_t counter = 0;
+    auto result = runner.run("increment", [&] {
+        ++counter;
+        helpers::benchmark::do_not_optimize(counter);
+    });
+
+    CHECK(result.name == "increment");
+    CHECK(result.iterations_per_sample > 1);
+    CHECK(result.ns_per_iteration.median > 0.0);
+    CHECK(result.ns_per_iteration.median <= result.ns_per_iteration.p99);
+    CHECK(counter >= 5 * result.iterations_per_sample);
+    CHECK(out.str().starts_with("increment"));
+    CHECK(runner.results().size() == 1);
+}
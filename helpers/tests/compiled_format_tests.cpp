@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include <compiled_format.hpp>
+#include <array>
+#include <string>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Rating
+    {
+        int value;
+    };
+} // namespace
+
+template <>
+struct std::formatter<Rating> : std::formatter<int>
+{
+    auto format(const Rating& rating, auto& ctx) const
+    {
+        return std::formatter<int>::format(rating.value, ctx);
+    }
+};
+
+TEST_CASE("fmt_string - compile-time parsing")
+{
+    using Fmt = helpers::fmt_string<"Gadget({}, {}).op<=>(Gadget({}, {}))">;
+
+    static_assert(Fmt::argument_count == 4);
+    static_assert(Fmt::segments[0].length == 7);
+    static_assert(Fmt::segments[1].is_argument);
+
+    static_assert(helpers::fmt_string<"{{literal}}">::argument_count == 0);
+
+    // helpers::fmt_string<"{:02X}">::argument_count; // ERROR - format specs are not supported
+}
+
+TEST_CASE("fmt_string - formatting")
+{
+    SECTION("matches std::format")
+    {
+        CHECK(helpers::format<"Gadget({}, {}).op<=>(Gadget({}, {}))">("ipad"s, 1.5, "mp3", 42) == std::format("Gadget({}, {}).op<=>(Gadget({}, {}))", "ipad"s, 1.5, "mp3", 42));
+        CHECK(helpers::format<"{} {} {} {}">(true, 'x', -7LL, 0.1f) == std::format("{} {} {} {}", true, 'x', -7LL, 0.1f));
+        CHECK(helpers::format<"{{{}}}">(1) == "{1}");
+    }
+
+    SECTION("types with std::formatter")
+    {
+        CHECK(helpers::format<"Rating({}).op==({})">(Rating{1}, Rating{2}) == "Rating(1).op==(2)");
+    }
+
+    SECTION("long output falls back to heap")
+    {
+        const std::string long_text(1000, 'a');
+        CHECK(helpers::format<"[{}]">(long_text) == "[" + long_text + "]");
+    }
+
+    SECTION("format_to - truncates and returns required size")
+    {
+        std::array<char, 4> buffer{};
+        CHECK(helpers::fmt_string<"value: {}">::format_to(buffer, 665) == 10);
+        CHECK(std::string_view{buffer.data(), buffer.size()} == "valu");
+    }
+}
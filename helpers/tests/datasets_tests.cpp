@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include <datasets.hpp>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+using helpers::Distribution;
+
+TEST_CASE("datasets - values in [low, high)")
+{
+    for (auto distribution : helpers::all_distributions)
+    {
+        INFO(helpers::to_string(distribution));
+
+        auto data = helpers::create_dataset(distribution, 10'000, 42, {.low = -10, .high = 10});
+
+        CHECK(data.size() == 10'000);
+        CHECK(std::ranges::all_of(data, [](int n) { return n >= -10 && n < 10; }));
+    }
+}
+
+TEST_CASE("datasets - empty range is rejected")
+{
+    for (auto distribution : helpers::all_distributions)
+    {
+        INFO(helpers::to_string(distribution));
+
+        CHECK_THROWS_AS(helpers::create_dataset(distribution, 5, 42, {.low = 5, .high = 5}), std::invalid_argument);
+        CHECK_THROWS_AS(helpers::create_dataset(distribution, 5, 42, {.low = 5, .high = -5}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("datasets - shapes")
+{
+    SECTION("sorted & reverse sorted")
+    {
+        CHECK(std::ranges::is_sorted(helpers::create_dataset(Distribution::sorted, 1000)));
+        CHECK(std::ranges::is_sorted(helpers::create_dataset(Distribution::reverse_sorted, 1000), std::greater{}));
+    }
+
+    SECTION("organ pipe")
+    {
+        auto data = helpers::create_dataset(Distribution::organ_pipe, 1000);
+        auto peak = std::ranges::max_element(data);
+
+        CHECK(std::ranges::is_sorted(data.begin(), peak + 1));
+        CHECK(std::ranges::is_sorted(peak, data.end(), std::greater{}));
+    }
+
+    SECTION("sawtooth")
+    {
+        auto data = helpers::create_dataset(Distribution::sawtooth, 256, 42, {.sawtooth_period = 64});
+
+        CHECK(data[0] == -100);
+        CHECK(data[64] == -100);
+        CHECK(std::ranges::is_sorted(data.begin(), data.begin() + 64));
+    }
+
+    SECTION("sawtooth - zero period is rejected")
+    {
+        CHECK_THROWS_AS(helpers::create_dataset(Distribution::sawtooth, 256, 42, {.sawtooth_period = 0}), std::invalid_argument);
+    }
+
+    SECTION("few unique")
+    {
+        auto data = helpers::create_dataset(Distribution::few_unique, 10'000, 42, {.unique_values = 5});
+        std::set unique_values(data.begin(), data.end());
+
+        CHECK(unique_values.size() <= 5);
+    }
+
+    SECTION("zipf - smallest rank is the most frequent")
+    {
+        auto data = helpers::create_dataset(Distribution::zipf, 10'000, 42, {.low = 0, .high = 100});
+
+        CHECK(std::ranges::count(data, 0) > std::ranges::count(data, 1));
+        CHECK(std::ranges::count(data, 1) > std::ranges::count(data, 10));
+    }
+
+    SECTION("normal - values concentrate around the mean")
+    {
+        auto data = helpers::create_dataset(Distribution::normal, 10'000, 42, {.low = 0, .high = 60});
+        auto within_one_sigma = std::ranges::count_if(data, [](int n) { return n >= 20 && n < 40; });
+
+        CHECK((within_one_sigma > 6'500 && within_one_sigma < 7'200));
+    }
+}
+
+TEST_CASE("datasets - compile-time")
+{
+    constexpr auto zipf_data = helpers::create_dataset<1000>(Distribution::zipf, 665);
+    constexpr auto normal_data = helpers::create_dataset<1000>(Distribution::normal, 665);
+
+    static_assert(std::ranges::is_sorted(helpers::create_dataset<1000>(Distribution::sorted)));
+
+    CHECK(std::ranges::equal(zipf_data, helpers::create_dataset(Distribution::zipf, 1000, 665)));
+    CHECK(std::ranges::equal(normal_data, helpers::create_dataset(Distribution::normal, 1000, 665)));
+}
+
+TEST_CASE("datasets - random strings")
+{
+    SECTION("runtime")
+    {
+        auto words = helpers::create_string_dataset(100, 3, 8);
+
+        CHECK(words.size() == 100);
+        CHECK(std::ranges::all_of(words, [](const auto& w) { return w.size() >= 3 && w.size() <= 8; }));
+        CHECK(std::ranges::all_of(words, [](const auto& w) { return std::ranges::all_of(w, [](char c) { return c >= 'a' && c <= 'z'; }); }));
+    }
+
+    SECTION("compile-time")
+    {
+        constexpr auto words = helpers::create_string_dataset<10, 4>(42, "01");
+
+        static_assert(std::ranges::all_of(words, [](const auto& w) { return std::ranges::all_of(w, [](char c) { return c == '0' || c == '1'; }); }));
+    }
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fill.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Rgb
+    {
+        std::uint8_t r, g, b;
+
+        bool operator==(const Rgb&) const = default;
+    };
+
+    struct Vec4
+    {
+        float x, y, z, w;
+
+        bool operator==(const Vec4&) const = default;
+    };
+
+    template <typename T>
+    void check_fill(const T& value, const helpers::FillOptions& options = {})
+    {
+        // every start offset and many lengths - covers head, aligned body and tail of broadcast_fill
+        std::vector<T> buffer(1024 + 16);
+        for (size_t offset = 0; offset < 8; ++offset)
+            for (size_t size : {0u, 1u, 3u, 7u, 16u, 33u, 100u, 1024u})
+            {
+                std::ranges::fill(buffer, T{});
+                helpers::fill(std::span{buffer}.subspan(offset, size), value, options);
+
+                for (size_t i = 0; i < buffer.size(); ++i)
+                {
+                    const bool inside = i >= offset && i < offset + size;
+                    if (buffer[i] != (inside ? value : T{}))
+                    {
+                        FAIL("offset: " << offset << ", size: " << size << ", index: " << i);
+                    }
+                }
+            }
+        SUCCEED();
+    }
+} // namespace
+
+TEST_CASE("fill - span")
+{
+    SECTION("byte-repeating values - memset")
+    {
+        check_fill<int>(0);
+        check_fill<int>(-1);
+        check_fill<std::uint32_t>(0x2A2A2A2A);
+    }
+
+    SECTION("other values - broadcast stores")
+    {
+        check_fill<std::uint8_t>(42);
+        check_fill<std::int16_t>(0x1234);
+        check_fill<int>(665);
+        check_fill<double>(3.14);
+        check_fill(Vec4{1.0f, 2.0f, 3.0f, 4.0f});
+    }
+
+    SECTION("sizes that do not divide a vector")
+    {
+        check_fill(Rgb{1, 2, 3});
+        check_fill(std::array<int, 3>{7, 8, 9});
+    }
+
+    SECTION("streaming stores")
+    {
+        const helpers::FillOptions streaming{.streaming_threshold = 0};
+
+        check_fill<int>(0, streaming);
+        check_fill<int>(665, streaming);
+        check_fill<std::int16_t>(-2, streaming);
+        check_fill(Vec4{1.0f, 2.0f, 3.0f, 4.0f}, streaming);
+    }
+
+    SECTION("many threads")
+    {
+        const helpers::FillOptions threaded{.streaming_threshold = 0, .max_threads = 4, .min_bytes_per_thread = 64};
+
+        std::vector<int> data(10'001, -7);
+        helpers::fill(std::span{data}, 42, threaded);
+
+        CHECK(std::ranges::all_of(data, [](int x) { return x == 42; }));
+    }
+
+    SECTION("not trivially copyable")
+    {
+        std::vector<std::string> words(5);
+        helpers::fill(std::span{words}, std::string{"text"});
+
+        CHECK(words == std::vector<std::string>(5, "text"));
+    }
+}
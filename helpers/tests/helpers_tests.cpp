@@ -0,0 +1,28 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helpers.hpp>
+#include <algorithm>
+
+TEST_CASE("create_numeric_dataset")
+{
+    SECTION("compile-time")
+    {
+        constexpr auto data = helpers::create_numeric_dataset<1000>(42);
+
+        static_assert(std::ranges::all_of(data, [](int n) { return n >= -100 && n < 100; }));
+    }
+
+    SECTION("runtime")
+    {
+        auto data = helpers::create_numeric_dataset<1000>(42, 0, 10);
+
+        CHECK(std::ranges::all_of(data, [](int n) { return n >= 0 && n < 10; }));
+        CHECK(std::ranges::count(data, 9) > 0);
+    }
+
+    SECTION("compile-time and runtime data are the same")
+    {
+        constexpr auto compile_time_data = helpers::create_numeric_dataset<1000>(42);
+
+        CHECK(std::ranges::equal(compile_time_data, helpers::create_numeric_dataset<1000>(42)));
+    }
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <hex.hpp>
+#include <random.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::vector<std::byte> random_bytes(size_t size, std::uint64_t seed = 665)
+    {
+        helpers::random::PCG rnd{seed};
+        std::vector<std::byte> bytes(size);
+        for (auto& b : bytes)
+            b = static_cast<std::byte>(rnd());
+        return bytes;
+    }
+
+    std::span<const std::byte> as_bytes(std::string_view text)
+    {
+        return std::as_bytes(std::span{text.data(), text.size()});
+    }
+} // namespace
+
+TEST_CASE("hex - encode")
+{
+    const float data[] = {std::numbers::pi_v<float>};
+
+    CHECK(helpers::hex::encode(std::as_bytes(std::span{data})) == "DB0F4940");
+    CHECK(helpers::hex::encode(std::as_bytes(std::span{data}), helpers::hex::Case::lower) == "db0f4940");
+    CHECK(helpers::hex::encode(std::span<const std::byte>{}).empty());
+
+    SECTION("SIMD kernels match the lookup table")
+    {
+        const auto bytes = random_bytes(1000);
+
+        for (size_t size : {1u, 15u, 16u, 17u, 31u, 32u, 33u, 64u, 100u, 1000u})
+        {
+            std::string expected(2 * size, '\0');
+            helpers::hex::details::encode_scalar(reinterpret_cast<const std::uint8_t*>(bytes.data()), size, expected.data(), helpers::hex::Case::upper);
+
+            CHECK(helpers::hex::encode(std::span{bytes}.first(size)) == expected);
+        }
+    }
+
+    SECTION("caller buffer")
+    {
+        std::array<char, 8> buffer{};
+        CHECK(helpers::hex::encode(as_bytes("abcd"), buffer) == 8);
+        CHECK(std::string_view{buffer.data(), buffer.size()} == "61626364");
+
+        CHECK_THROWS_AS(helpers::hex::encode(as_bytes("abcde"), buffer), std::length_error);
+    }
+}
+
+TEST_CASE("hex - decode")
+{
+    std::array<std::byte, 64> out{};
+
+    CHECK(helpers::hex::decode("DB0f4940", out) == 4);
+    CHECK(out[0] == std::byte{0xDB});
+    CHECK(out[3] == std::byte{0x40});
+
+    SECTION("round trip")
+    {
+        const auto bytes = random_bytes(1001, 42);
+
+        for (size_t size : {0u, 1u, 15u, 16u, 17u, 33u, 1001u})
+        {
+            const auto hex = helpers::hex::encode(std::span{bytes}.first(size), size % 2 ? helpers::hex::Case::upper : helpers::hex::Case::lower);
+
+            std::vector<std::byte> decoded(size);
+            REQUIRE(helpers::hex::decode(hex, decoded) == size);
+            CHECK(std::ranges::equal(decoded, std::span{bytes}.first(size)));
+        }
+    }
+
+    SECTION("invalid input")
+    {
+        CHECK_FALSE(helpers::hex::decode("abc", out).has_value());
+        CHECK_FALSE(helpers::hex::decode("0102", std::span{out}.first(1)).has_value());
+
+        // every position - in the SIMD block and in the scalar tail
+        const std::string valid(2 * 40, 'a');
+        for (size_t pos = 0; pos < valid.size(); ++pos)
+            for (char c : {'g', 'G', '/', ':', '@', '`', ' ', '\0', '\x80', '\xFF'})
+            {
+                std::string hex = valid;
+                hex[pos] = c;
+                std::vector<std::byte> decoded(hex.size() / 2);
+                if (helpers::hex::decode(hex, decoded).has_value())
+                    FAIL("accepted '" << c << "' at " << pos);
+            }
+        SUCCEED();
+    }
+}
+
+TEST_CASE("hex - xxd layout")
+{
+    SECTION("default - 16 columns, groups of 2")
+    {
+        CHECK(helpers::hex::xxd(as_bytes("Hello World\n")) == "00000000: 4865 6c6c 6f20 576f 726c 640a            Hello World.\n");
+
+        CHECK(helpers::hex::xxd(as_bytes("0123456789abcdef0123")) == "00000000: 3031 3233 3435 3637 3839 6162 6364 6566  0123456789abcdef\n"
+                                                                   "00000010: 3031 3233                                0123\n");
+    }
+
+    SECTION("xxd -g 1 -c 8 -u")
+    {
+        const helpers::hex::XxdOptions options{.columns = 8, .group_size = 1, .letter_case = helpers::hex::Case::upper};
+
+        CHECK(helpers::hex::xxd(as_bytes("abcdefghijklmnopqrstuvwxyz"), options) == "00000000: 61 62 63 64 65 66 67 68  abcdefgh\n"
+                                                                                   "00000008: 69 6A 6B 6C 6D 6E 6F 70  ijklmnop\n"
+                                                                                   "00000010: 71 72 73 74 75 76 77 78  qrstuvwx\n"
+                                                                                   "00000018: 79 7A                    yz\n");
+    }
+
+    SECTION("caller buffer")
+    {
+        std::vector<char> buffer(helpers::hex::xxd_size(3));
+        const size_t size = helpers::hex::xxd(as_bytes("\x01\x7F\x20"), buffer);
+
+        CHECK(std::string_view{buffer.data(), size} == "00000000: 017f 20                                  .. \n");
+        CHECK_THROWS_AS(helpers::hex::xxd(as_bytes("seventeen bytes!!"), buffer), std::length_error); // two lines
+    }
+}
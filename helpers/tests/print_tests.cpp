@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helpers.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Point
+    {
+        int x, y;
+
+        friend std::ostream& operator<<(std::ostream& out, const Point& pt)
+        {
+            return out << "(" << pt.x << ", " << pt.y << ")";
+        }
+    };
+
+    std::ostringstream nested_log;
+
+    // prints from inside an outer print() - both use OutputBuffer on the same thread
+    struct Traced
+    {
+        int value;
+
+        friend std::ostream& operator<<(std::ostream& out, const Traced& traced)
+        {
+            helpers::print(std::vector{traced.value}, "nested", {.sink = nested_log});
+            return out << "T" << traced.value;
+        }
+    };
+
+    template <typename T>
+    std::string ostream_style(const std::vector<T>& items, std::string_view prefix)
+    {
+        std::ostringstream out;
+        out << prefix << " = [";
+        for (const auto& item : items)
+            out << item << " ";
+        out << "]\n";
+        return out.str();
+    }
+
+    std::string read_all(std::FILE* file)
+    {
+        std::rewind(file);
+
+        std::string content;
+        char chunk[256];
+        while (auto count = std::fread(chunk, 1, sizeof(chunk), file))
+            content.append(chunk, count);
+
+        return content;
+    }
+} // namespace
+
+TEST_CASE("print - format")
+{
+    std::ostringstream out;
+
+    SECTION("numbers")
+    {
+        helpers::print(std::vector{1, -2, 3}, "vec", {.sink = out});
+        CHECK(out.str() == "vec = [1 -2 3 ]\n");
+    }
+
+    SECTION("strings are quoted")
+    {
+        helpers::print(std::vector{"one"s, "two"s}, "words", {.sink = out});
+        CHECK(out.str() == "words = [\"one\" \"two\" ]\n");
+    }
+
+    SECTION("types with operator<< only")
+    {
+        helpers::print(std::vector{Point{1, 2}}, "points", {.sink = out});
+        CHECK(out.str() == "points = [(1, 2) ]\n");
+    }
+
+    SECTION("the same text as operator<<")
+    {
+        const std::vector doubles{1.0 / 3, 1e20, 0.1, 123456789.0, -2.5e-7, 100.0};
+        helpers::print(doubles, "doubles", {.sink = out});
+        CHECK(out.str() == ostream_style(doubles, "doubles"));
+    }
+
+    SECTION("int8_t, uint8_t and char are characters")
+    {
+        helpers::print(std::vector<std::int8_t>{'a', 'b'}, "i8", {.sink = out});
+        helpers::print(std::vector<std::uint8_t>{'c'}, "u8", {.sink = out});
+        helpers::print(std::vector{'d'}, "chars", {.sink = out});
+        CHECK(out.str() == "i8 = [a b ]\nu8 = [c ]\nchars = [d ]\n");
+    }
+
+    SECTION("nested print on the same thread")
+    {
+        nested_log.str("");
+        helpers::print(std::vector{Traced{1}, Traced{2}}, "outer", {.sink = out});
+        CHECK(out.str() == "outer = [T1 T2 ]\n");
+        CHECK(nested_log.str() == "nested = [1 ]\nnested = [2 ]\n");
+    }
+
+    SECTION("max_items truncation")
+    {
+        helpers::print(std::views::iota(0), "naturals", {.max_items = 3, .sink = out});
+        CHECK(out.str() == "naturals = [0 1 2 ... ]\n");
+    }
+}
+
+TEST_CASE("print - large ranges are flushed in chunks")
+{
+    std::vector<int> data(1'000'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    helpers::print(data, "data", {.sink = file});
+
+    auto content = read_all(file);
+    std::fclose(file);
+
+    CHECK(content.starts_with("data = [0 1 2 "));
+    CHECK(content.ends_with(" 999998 999999 ]\n"));
+}
+
+TEST_CASE("print - file descriptor")
+{
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    helpers::print(std::vector{1.5, 2.25}, "fd", {.sink = helpers::OutputSink::from_fd(fileno(file))});
+
+    CHECK(read_all(file) == "fd = [1.5 2.25 ]\n");
+    std::fclose(file);
+}
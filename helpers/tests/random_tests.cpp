@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+#include <random.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <set>
+#include <vector>
+
+using helpers::random::PCG;
+
+TEST_CASE("PCG - advance")
+{
+    PCG rnd_1{42};
+    PCG rnd_2{42};
+
+    for (int i = 0; i < 1000; ++i)
+        rnd_1();
+
+    rnd_2.advance(1000);
+
+    CHECK(rnd_1 == rnd_2);
+    CHECK(rnd_1() == rnd_2());
+
+    SECTION("discard is an alias for advance")
+    {
+        PCG rnd_3{42};
+        rnd_3.discard(1001);
+
+        CHECK(rnd_3 == rnd_2);
+    }
+
+    SECTION("advance by 2^64 is a full period")
+    {
+        PCG rnd_3 = rnd_2;
+        rnd_3.advance(std::numeric_limits<std::uint64_t>::max());
+        rnd_3();
+
+        CHECK(rnd_3 == rnd_2);
+    }
+}
+
+TEST_CASE("PCG - streams")
+{
+    PCG stream_1{42, 1};
+    PCG stream_2{42, 2};
+
+    CHECK(stream_1.stream() == 1);
+    CHECK(stream_2.stream() == 2);
+
+    std::array<PCG::result_type, 8> values_1{};
+    std::array<PCG::result_type, 8> values_2{};
+    std::ranges::generate(values_1, std::ref(stream_1));
+    std::ranges::generate(values_2, std::ref(stream_2));
+
+    CHECK(values_1 != values_2);
+
+    SECTION("same seed and stream - same sequence")
+    {
+        PCG stream_1_copy{42, 1};
+        stream_1_copy.advance(8);
+
+        CHECK(stream_1_copy == stream_1);
+    }
+}
+
+TEST_CASE("PCG - split")
+{
+    PCG rnd{665, 7};
+
+    auto substreams = rnd.split(4);
+    REQUIRE(substreams.size() == 4);
+    CHECK(substreams[0] == rnd);
+
+    SECTION("substreams are blocks of the same sequence")
+    {
+        PCG expected = rnd;
+        expected.advance(2 * (std::numeric_limits<std::uint64_t>::max() / 4));
+
+        CHECK(substreams[2] == expected);
+    }
+
+    SECTION("substreams do not overlap")
+    {
+        std::set<PCG::result_type> values;
+        for (auto& substream : substreams)
+            for (int i = 0; i < 256; ++i)
+                values.insert(substream());
+
+        CHECK(values.size() > 1000);
+    }
+}
+
+constexpr auto discarded_value()
+{
+    PCG rnd{42, 54};
+    rnd.discard(100);
+    return rnd();
+}
+
+constexpr auto first_value_of_last_substream()
+{
+    PCG rnd{42, 54};
+    return rnd.split(8).back()();
+}
+
+TEST_CASE("PCG - compile-time")
+{
+    static_assert(discarded_value() != 0);
+
+    PCG rnd{42, 54};
+    rnd.discard(100);
+    CHECK(rnd() == discarded_value());
+
+    constexpr auto value = first_value_of_last_substream();
+    CHECK(PCG{42, 54}.split(8)[7]() == value);
+}
+
+TEST_CASE("bounded - Lemire's method")
+{
+    PCG rnd{42};
+
+    std::array<int, 6> histogram{};
+    for (int i = 0; i < 60'000; ++i)
+    {
+        auto value = helpers::random::bounded(rnd, 6);
+        REQUIRE(value < 6);
+        ++histogram[value];
+    }
+
+    for (int count : histogram)
+        CHECK((count > 9'000 && count < 11'000));
+
+    SECTION("range 0 is the full 2^32 range")
+    {
+        PCG same_rnd = rnd;
+        for (int i = 0; i < 100; ++i)
+            CHECK(helpers::random::bounded(rnd, 0) == same_rnd());
+
+        static_assert([] {
+            PCG compile_time_rnd{7};
+            return helpers::random::bounded(compile_time_rnd, 0) == PCG{7}();
+        }());
+    }
+}
+
+TEST_CASE("PCGBatch")
+{
+    helpers::random::PCGBatch<8> batch_rnd{42};
+
+    SECTION("lane i is stream i")
+    {
+        auto first = batch_rnd();
+        auto second = batch_rnd();
+
+        for (std::uint64_t lane = 0; lane < 8; ++lane)
+        {
+            PCG lane_rnd{42, lane};
+            CHECK(first[lane] == lane_rnd());
+            CHECK(second[lane] == lane_rnd());
+        }
+    }
+
+    SECTION("fill - batches and tail")
+    {
+        helpers::random::PCGBatch<8> same_rnd{42};
+
+        std::vector<std::uint32_t> values(21);
+        batch_rnd.fill(values);
+
+        std::vector<std::uint32_t> expected;
+        for (int i = 0; i < 3; ++i)
+        {
+            auto batch = same_rnd();
+            expected.insert(expected.end(), batch.begin(), batch.end());
+        }
+        expected.resize(21);
+
+        CHECK(values == expected);
+    }
+
+    SECTION("fill_bounded")
+    {
+        std::vector<std::uint32_t> values(1000);
+        batch_rnd.fill_bounded(values, 200);
+
+        CHECK(std::ranges::all_of(values, [](auto v) { return v < 200; }));
+        CHECK(std::ranges::max(values) > 190);
+    }
+
+    SECTION("fill_bounded - range 0 is the full 2^32 range")
+    {
+        helpers::random::PCGBatch<8> same_rnd{42};
+
+        std::vector<std::uint32_t> values(21);
+        batch_rnd.fill_bounded(values, 0);
+
+        std::vector<std::uint32_t> expected(21);
+        same_rnd.fill(expected);
+
+        CHECK(values == expected);
+    }
+
+    SECTION("fill - floats in [0, 1)")
+    {
+        std::vector<float> values(1003);
+        batch_rnd.fill(values);
+
+        CHECK(std::ranges::all_of(values, [](float v) { return v >= 0.0f && v < 1.0f; }));
+        CHECK(helpers::random::to_unit_float(0xFFFF'FFFF) < 1.0f);
+    }
+}
+
+TEST_CASE("PCGBatch - 16 lanes at compile-time")
+{
+    constexpr auto batch = helpers::random::PCGBatch<16>{665}();
+
+    PCG lane_rnd{665, 15};
+    CHECK(batch[15] == lane_rnd());
+}
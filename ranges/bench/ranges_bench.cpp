@@ -0,0 +1,40 @@
+#include <benchmark.hpp>
+#include <helpers.hpp>
+
+#include <algorithm>
+#include <format>
+#include <vector>
+
+using helpers::benchmark::do_not_optimize;
+
+HELPERS_BENCHMARK("ranges - sort 100k x int")
+{
+    for (auto distribution : helpers::all_distributions)
+    {
+        const auto dataset = helpers::create_dataset(distribution, 100'000, 42, {.low = -1'000'000, .high = 1'000'000});
+        std::vector<int> data;
+
+        bench.run(std::format("std::ranges::sort - {}", helpers::to_string(distribution)), [&] {
+            data = dataset;
+            std::ranges::sort(data);
+            do_not_optimize(data.data());
+        });
+    }
+}
+
+HELPERS_BENCHMARK("ranges - sort + unique 100k x int")
+{
+    for (auto distribution : {helpers::Distribution::uniform, helpers::Distribution::few_unique, helpers::Distribution::zipf})
+    {
+        const auto dataset = helpers::create_dataset(distribution, 100'000);
+        std::vector<int> data;
+
+        bench.run(std::format("sort + unique - {}", helpers::to_string(distribution)), [&] {
+            data = dataset;
+            std::ranges::sort(data);
+            auto [first, last] = std::ranges::unique(data);
+            data.erase(first, last);
+            do_not_optimize(data.data());
+        });
+    }
+}
@@ -0,0 +1,154 @@
+#include <benchmark.hpp>
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "lock_free_queue.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // baseline - "mutex + data"
+    template <typename T>
+    class LockedDeque
+    {
+    public:
+        bool try_push(T item)
+        {
+            std::scoped_lock lk{mtx_};
+            items_.push_back(std::move(item));
+            return true;
+        }
+
+        bool try_pop(T& item)
+        {
+            std::scoped_lock lk{mtx_};
+            if (items_.empty())
+                return false;
+            item = std::move(items_.front());
+            items_.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mtx_;
+        std::deque<T> items_;
+    };
+
+    constexpr int items_per_run = 1'000'000;
+    constexpr int round_trips_per_run = 10'000;
+
+    // spinning falls back to yield - benchmarks must also work with fewer cores than threads
+    template <typename TQueue>
+    void push(TQueue& queue, int item)
+    {
+        while (!queue.try_push(item))
+            std::this_thread::yield();
+    }
+
+    template <typename TQueue>
+    int pop(TQueue& queue)
+    {
+        int item;
+        while (!queue.try_pop(item))
+            std::this_thread::yield();
+        return item;
+    }
+
+    template <typename TQueue>
+    long long transfer(TQueue& queue)
+    {
+        long long sum = 0;
+        std::jthread consumer{[&] {
+            for (int i = 0; i < items_per_run; ++i)
+                sum += pop(queue);
+        }};
+
+        for (int i = 0; i < items_per_run; ++i)
+            push(queue, i);
+
+        consumer.join();
+        return sum;
+    }
+
+    template <typename TQueue>
+    int ping_pong(TQueue& requests, TQueue& responses)
+    {
+        std::jthread echo{[&] {
+            for (int i = 0; i < round_trips_per_run; ++i)
+                push(responses, pop(requests));
+        }};
+
+        int last = 0;
+        for (int i = 0; i < round_trips_per_run; ++i)
+        {
+            push(requests, i);
+            last = pop(responses);
+        }
+        return last;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("lock-free queues - throughput, 1M ints, 1 producer & 1 consumer")
+{
+    LockedDeque<int> locked;
+    bench.run("std::mutex + std::deque", [&] { do_not_optimize(transfer(locked)); });
+
+    lock_free::SpscRing<int> spsc{1024};
+    bench.run("SpscRing - try_push/try_pop", [&] { do_not_optimize(transfer(spsc)); });
+
+    bench.run("SpscRing - batches of 64", [&] {
+        long long sum = 0;
+        std::jthread consumer{[&] {
+            std::array<int, 64> batch;
+            for (int received = 0; received < items_per_run;)
+            {
+                const size_t count = spsc.pop(batch);
+                for (size_t i = 0; i < count; ++i)
+                    sum += batch[i];
+                received += static_cast<int>(count);
+                if (count == 0)
+                    std::this_thread::yield();
+            }
+        }};
+
+        std::array<int, 64> batch;
+        for (int sent = 0; sent < items_per_run;)
+        {
+            const size_t size = std::min<size_t>(batch.size(), items_per_run - sent);
+            for (size_t i = 0; i < size; ++i)
+                batch[i] = sent + static_cast<int>(i);
+
+            for (size_t pushed = 0; pushed < size;)
+            {
+                const size_t count = spsc.push(std::span{batch}.subspan(pushed, size - pushed));
+                pushed += count;
+                if (count == 0)
+                    std::this_thread::yield();
+            }
+            sent += static_cast<int>(size);
+        }
+
+        consumer.join();
+        do_not_optimize(sum);
+    });
+
+    lock_free::MpmcQueue<int> mpmc{1024};
+    bench.run("MpmcQueue", [&] { do_not_optimize(transfer(mpmc)); });
+}
+
+HELPERS_BENCHMARK("lock-free queues - latency, 10k round trips")
+{
+    LockedDeque<int> locked_requests, locked_responses;
+    bench.run("std::mutex + std::deque", [&] { do_not_optimize(ping_pong(locked_requests, locked_responses)); });
+
+    lock_free::SpscRing<int> spsc_requests{64}, spsc_responses{64};
+    bench.run("SpscRing", [&] { do_not_optimize(ping_pong(spsc_requests, spsc_responses)); });
+
+    lock_free::MpmcQueue<int> mpmc_requests{64}, mpmc_responses{64};
+    bench.run("MpmcQueue", [&] { do_not_optimize(ping_pong(mpmc_requests, mpmc_responses)); });
+}
@@ -0,0 +1,105 @@
+#include <benchmark.hpp>
+
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "read_mostly.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr int reads_per_thread = 100'000;
+    constexpr int writes_per_thread = 100'000;
+
+    template <typename TFunction>
+    void run_in_threads(int thread_count, TFunction f)
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < thread_count; ++t)
+            threads.emplace_back(f, t);
+    }
+} // namespace
+
+HELPERS_BENCHMARK("read-mostly - readers")
+{
+    const std::vector<int> initial(16, 1);
+
+    std::vector<int> vec = initial;
+    std::mutex mtx_vec;
+
+    concurrent::ReadMostly<std::vector<int>> data{initial};
+
+    for (int thread_count : {1, 4})
+    {
+        const std::string threads = std::to_string(thread_count) + " thread(s)";
+
+        bench.run("std::mutex + std::vector - " + threads, [&] {
+            run_in_threads(thread_count, [&](int) {
+                long long sum = 0;
+                for (int i = 0; i < reads_per_thread; ++i)
+                {
+                    std::scoped_lock lk{mtx_vec};
+                    sum += vec[i % vec.size()];
+                }
+                do_not_optimize(sum);
+            });
+        });
+
+        bench.run("ReadMostly::snapshot() - " + threads, [&] {
+            run_in_threads(thread_count, [&](int) {
+                long long sum = 0;
+                for (int i = 0; i < reads_per_thread; ++i)
+                {
+                    auto snapshot = data.snapshot();
+                    sum += (*snapshot)[i % snapshot->size()];
+                }
+                do_not_optimize(sum);
+            });
+        });
+
+        bench.run("ReadMostly::Reader - " + threads, [&] {
+            run_in_threads(thread_count, [&](int) {
+                auto reader = data.reader();
+                long long sum = 0;
+                for (int i = 0; i < reads_per_thread; ++i)
+                {
+                    const auto& items = reader.get();
+                    sum += items[i % items.size()];
+                }
+                do_not_optimize(sum);
+            });
+        });
+    }
+}
+
+HELPERS_BENCHMARK("read-mostly - map writers, 4 threads")
+{
+    constexpr int thread_count = 4;
+
+    std::unordered_map<int, int> map;
+    std::mutex mtx_map;
+
+    bench.run("std::mutex + std::unordered_map", [&] {
+        run_in_threads(thread_count, [&](int t) {
+            for (int i = 0; i < writes_per_thread; ++i)
+            {
+                std::scoped_lock lk{mtx_map};
+                ++map[t * 1000 + i % 1000];
+            }
+        });
+    });
+
+    concurrent::ShardedMap<int, int> sharded;
+
+    bench.run("ShardedMap", [&] {
+        run_in_threads(thread_count, [&](int t) {
+            for (int i = 0; i < writes_per_thread; ++i)
+                sharded.update(t * 1000 + i % 1000, [](int& counter) { ++counter; });
+        });
+    });
+}
@@ -0,0 +1,473 @@
+#ifndef LOCK_FREE_QUEUE_HPP
+#define LOCK_FREE_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Bounded lock-free queues - an alternative to a std::mutex guarding a std::deque ("mutex + data" in small_features.cpp).
+//
+// Both queues keep a control block (positions, capacity) followed by the slots in one region of bytes - allocated
+// by the queue or provided by the caller. A caller-provided region may be placed in shared memory (lock-free
+// std::atomic<size_t> is address-free): one process creates the queue in it, others attach to it with
+// lock_free::attach and the same bytes (mapped at any address). For more than one process T must be trivially copyable.
+// Capacity must be a power of two; positions grow monotonically and are mapped to slots with a mask.
+// Items are assigned into existing slots, so T must be default constructible.
+namespace lock_free
+{
+    // std::hardware_destructive_interference_size depends on compiler flags (gcc warns about its use in headers)
+    inline constexpr size_t cache_line_size = 64;
+
+    template <typename T>
+    concept Queueable = std::is_default_constructible_v<T> && std::is_move_assignable_v<T>;
+
+    static_assert(std::atomic<size_t>::is_always_lock_free);
+
+    struct attach_t
+    {
+        explicit attach_t() = default;
+    };
+
+    // the region already holds a queue - use it as it is
+    inline constexpr attach_t attach{};
+
+    namespace details
+    {
+        inline size_t checked_mask(size_t capacity)
+        {
+            if (!std::has_single_bit(capacity))
+                throw std::invalid_argument("queue capacity must be a power of two");
+            return capacity - 1;
+        }
+
+        // Control block followed by `capacity` slots in one buffer. The instance that created them destroys them;
+        // attached instances only use them.
+        template <typename Control, typename Slot>
+        class Region
+        {
+        public:
+            static_assert(alignof(Slot) <= alignof(Control));
+
+            static constexpr size_t slots_offset = (sizeof(Control) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+            static constexpr size_t size_for(size_t capacity)
+            {
+                return slots_offset + capacity * sizeof(Slot);
+            }
+
+            Region(std::span<std::byte> storage, size_t capacity)
+            {
+                create(storage, capacity);
+            }
+
+            Region(attach_t, std::span<std::byte> storage)
+            {
+                check_alignment(storage);
+                if (storage.size() < slots_offset)
+                    throw std::invalid_argument("storage too small for a queue");
+
+                control_ = std::launder(reinterpret_cast<Control*>(storage.data()));
+                capacity_ = control_->capacity;
+                checked_mask(capacity_);
+                if (storage.size() < size_for(capacity_))
+                    throw std::invalid_argument("storage too small for the queue capacity");
+
+                slots_ = std::launder(reinterpret_cast<Slot*>(storage.data() + slots_offset));
+            }
+
+            explicit Region(size_t capacity)
+                : owned_{static_cast<std::byte*>(::operator new(size_for(checked_mask(capacity) + 1), std::align_val_t{alignof(Control)}))}
+            {
+                create({owned_.get(), size_for(capacity)}, capacity);
+            }
+
+            Region(const Region&) = delete;
+            Region& operator=(const Region&) = delete;
+
+            ~Region()
+            {
+                if (creator_)
+                {
+                    std::destroy_n(slots_, capacity_);
+                    control_->~Control();
+                }
+            }
+
+            Control& control() const noexcept
+            {
+                return *control_;
+            }
+
+            Slot* slots() const noexcept
+            {
+                return slots_;
+            }
+
+            size_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+        private:
+            struct AlignedDelete
+            {
+                void operator()(std::byte* ptr) const noexcept
+                {
+                    ::operator delete(ptr, std::align_val_t{alignof(Control)});
+                }
+            };
+
+            std::unique_ptr<std::byte, AlignedDelete> owned_;
+            Control* control_ = nullptr;
+            Slot* slots_ = nullptr;
+            size_t capacity_ = 0;
+            bool creator_ = false;
+
+            static void check_alignment(std::span<std::byte> storage)
+            {
+                if (reinterpret_cast<std::uintptr_t>(storage.data()) % alignof(Control) != 0)
+                    throw std::invalid_argument("queue storage must be aligned to a cache line");
+            }
+
+            void create(std::span<std::byte> storage, size_t capacity)
+            {
+                checked_mask(capacity);
+                check_alignment(storage);
+                if (storage.size() < size_for(capacity))
+                    throw std::invalid_argument("storage too small for the queue capacity");
+
+                Slot* slots = reinterpret_cast<Slot*>(storage.data() + slots_offset);
+                std::uninitialized_value_construct_n(slots, capacity);
+
+                control_ = ::new (static_cast<void*>(storage.data())) Control{};
+                control_->capacity = capacity;
+                slots_ = std::launder(slots);
+                capacity_ = capacity;
+                creator_ = true;
+            }
+        };
+    } // namespace details
+
+    // single producer, single consumer
+    //
+    // Each side owns one index and keeps a cached copy of the other one - the shared index (another core's cache line)
+    // is read only when the cached value says the ring is full (producer) or empty (consumer).
+    template <Queueable T>
+    class SpscRing
+    {
+        struct alignas(cache_line_size) Side
+        {
+            std::atomic<size_t> position{0}; // written only by this side
+            size_t cached_other{0};           // last seen position of the other side
+        };
+
+        struct ControlBlock
+        {
+            Side producer; // tail
+            Side consumer; // head
+            size_t capacity;
+        };
+
+        using Region = details::Region<ControlBlock, T>;
+
+    public:
+        // bytes of caller storage (aligned to a cache line) needed for a ring of `capacity` items
+        static constexpr size_t storage_size(size_t capacity)
+        {
+            return Region::size_for(capacity);
+        }
+
+        // creates an empty ring in storage
+        SpscRing(std::span<std::byte> storage, size_t capacity)
+            : region_{storage, capacity}
+            , mask_{capacity - 1}
+        {
+        }
+
+        // attaches to a ring already created in storage (e.g. by another process)
+        SpscRing(attach_t, std::span<std::byte> storage)
+            : region_{attach, storage}
+            , mask_{region_.capacity() - 1}
+        {
+        }
+
+        explicit SpscRing(size_t capacity)
+            : region_{capacity}
+            , mask_{capacity - 1}
+        {
+        }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // approximate if called while the other side is working
+        size_t size() const noexcept
+        {
+            const ControlBlock& control = region_.control();
+            return control.producer.position.load(std::memory_order_acquire) - control.consumer.position.load(std::memory_order_acquire);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        // producer
+
+        template <typename U>
+            requires std::assignable_from<T&, U&&>
+        bool try_push(U&& item)
+        {
+            const size_t tail = producer().position.load(std::memory_order_relaxed);
+
+            if (tail - producer().cached_other == capacity())
+            {
+                producer().cached_other = consumer().position.load(std::memory_order_acquire);
+                if (tail - producer().cached_other == capacity())
+                    return false;
+            }
+
+            region_.slots()[tail & mask_] = std::forward<U>(item);
+            producer().position.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // pushes as many items as fit - one index publication per batch; returns number of pushed items
+        size_t push(std::span<const T> items)
+        {
+            const size_t tail = producer().position.load(std::memory_order_relaxed);
+
+            if (capacity() - (tail - producer().cached_other) < items.size())
+                producer().cached_other = consumer().position.load(std::memory_order_acquire);
+
+            const size_t count = std::min(items.size(), capacity() - (tail - producer().cached_other));
+            if (count == 0)
+                return 0;
+
+            const size_t first = tail & mask_;
+            const size_t before_wrap = std::min(count, capacity() - first);
+            std::copy_n(items.begin(), before_wrap, region_.slots() + first);
+            std::copy_n(items.begin() + before_wrap, count - before_wrap, region_.slots());
+
+            producer().position.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        // consumer
+
+        bool try_pop(T& item)
+        {
+            const size_t head = consumer().position.load(std::memory_order_relaxed);
+
+            if (head == consumer().cached_other)
+            {
+                consumer().cached_other = producer().position.load(std::memory_order_acquire);
+                if (head == consumer().cached_other)
+                    return false;
+            }
+
+            item = std::move(region_.slots()[head & mask_]);
+            consumer().position.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        std::optional<T> try_pop()
+        {
+            T item;
+            if (!try_pop(item))
+                return std::nullopt;
+            return item;
+        }
+
+        // pops up to out.size() items; returns number of popped items
+        size_t pop(std::span<T> out)
+        {
+            const size_t head = consumer().position.load(std::memory_order_relaxed);
+
+            if (consumer().cached_other - head < out.size())
+                consumer().cached_other = producer().position.load(std::memory_order_acquire);
+
+            const size_t count = std::min(out.size(), consumer().cached_other - head);
+            if (count == 0)
+                return 0;
+
+            const size_t first = head & mask_;
+            const size_t before_wrap = std::min(count, capacity() - first);
+            std::move(region_.slots() + first, region_.slots() + first + before_wrap, out.begin());
+            std::move(region_.slots(), region_.slots() + (count - before_wrap), out.begin() + before_wrap);
+
+            consumer().position.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+    private:
+        Region region_;
+        size_t mask_;
+
+        Side& producer() const noexcept
+        {
+            return region_.control().producer;
+        }
+
+        Side& consumer() const noexcept
+        {
+            return region_.control().consumer;
+        }
+    };
+
+    // multiple producers, multiple consumers - Dmitry Vyukov's bounded queue
+    //
+    // Every cell has a sequence number telling which lap of the ring it is ready for:
+    //   sequence == position     - free, a producer may claim position with a CAS
+    //   sequence == position + 1 - full, a consumer may claim position with a CAS
+    // Producers and consumers contend only on their own counter, never on a lock.
+    template <Queueable T>
+    class MpmcQueue
+    {
+    public:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+    private:
+        struct ControlBlock
+        {
+            size_t capacity;
+            alignas(cache_line_size) std::atomic<size_t> enqueue_position{0};
+            alignas(cache_line_size) std::atomic<size_t> dequeue_position{0};
+        };
+
+        using Region = details::Region<ControlBlock, Cell>;
+
+    public:
+        // bytes of caller storage (aligned to a cache line) needed for a queue of `capacity` items
+        static constexpr size_t storage_size(size_t capacity)
+        {
+            return Region::size_for(capacity);
+        }
+
+        // creates an empty queue in storage
+        MpmcQueue(std::span<std::byte> storage, size_t capacity)
+            : region_{storage, capacity}
+            , mask_{capacity - 1}
+        {
+            init_cells();
+        }
+
+        // attaches to a queue already created in storage (e.g. by another process) - cells are not touched
+        MpmcQueue(attach_t, std::span<std::byte> storage)
+            : region_{attach, storage}
+            , mask_{region_.capacity() - 1}
+        {
+        }
+
+        explicit MpmcQueue(size_t capacity)
+            : region_{capacity}
+            , mask_{capacity - 1}
+        {
+            init_cells();
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        template <typename U>
+            requires std::assignable_from<T&, U&&>
+        bool try_push(U&& item)
+        {
+            size_t position = region_.control().enqueue_position.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &region_.slots()[position & mask_];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if (diff == 0)
+                {
+                    if (region_.control().enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0) // full - the cell still holds an item from the previous lap
+                    return false;
+                else // another producer took the position
+                    position = region_.control().enqueue_position.load(std::memory_order_relaxed);
+            }
+
+            cell->value = std::forward<U>(item);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(T& item)
+        {
+            size_t position = region_.control().dequeue_position.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &region_.slots()[position & mask_];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+                if (diff == 0)
+                {
+                    if (region_.control().dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0) // empty
+                    return false;
+                else
+                    position = region_.control().dequeue_position.load(std::memory_order_relaxed);
+            }
+
+            item = std::move(cell->value);
+            cell->sequence.store(position + mask_ + 1, std::memory_order_release); // free for the next lap
+            return true;
+        }
+
+        std::optional<T> try_pop()
+        {
+            T item;
+            if (!try_pop(item))
+                return std::nullopt;
+            return item;
+        }
+
+    private:
+        Region region_;
+        size_t mask_;
+
+        void init_cells() noexcept
+        {
+            for (size_t i = 0; i < capacity(); ++i)
+                region_.slots()[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    };
+} // namespace lock_free
+
+#endif
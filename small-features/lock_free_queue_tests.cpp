@@ -0,0 +1,202 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lock_free_queue.hpp"
+
+TEST_CASE("SpscRing")
+{
+    alignas(lock_free::cache_line_size) std::array<std::byte, lock_free::SpscRing<std::string>::storage_size(4)> storage;
+    lock_free::SpscRing<std::string> ring{storage, 4};
+
+    CHECK(ring.capacity() == 4);
+    CHECK(ring.empty());
+    CHECK_FALSE(ring.try_pop().has_value());
+
+    SECTION("push & pop")
+    {
+        CHECK(ring.try_push("one"));
+        CHECK(ring.try_push(std::string{"two"}));
+        CHECK(ring.size() == 2);
+
+        CHECK(ring.try_pop() == "one");
+        CHECK(ring.try_pop() == "two");
+        CHECK(ring.empty());
+    }
+
+    SECTION("bounded")
+    {
+        for (int i = 0; i < 4; ++i)
+            CHECK(ring.try_push(std::to_string(i)));
+        CHECK_FALSE(ring.try_push("overflow"));
+
+        CHECK(ring.try_pop() == "0");
+        CHECK(ring.try_push("4"));
+    }
+
+    SECTION("batches wrap around")
+    {
+        const std::vector<std::string> items = {"a", "b", "c", "d", "e"};
+        std::vector<std::string> out(5);
+
+        CHECK(ring.push(std::span{items}.first(3)) == 3);
+        CHECK(ring.pop(std::span{out}.first(2)) == 2);
+        CHECK(ring.push(items) == 3); // only 3 slots left
+
+        CHECK(ring.pop(out) == 4);
+        CHECK(out[0] == "c");
+        CHECK(out[1] == "a");
+        CHECK(out[3] == "c");
+        CHECK(ring.pop(out) == 0);
+    }
+
+    SECTION("capacity must be a power of two")
+    {
+        CHECK_THROWS_AS(lock_free::SpscRing<int>{6}, std::invalid_argument);
+    }
+
+    SECTION("storage is checked")
+    {
+        CHECK_THROWS_AS((lock_free::SpscRing<std::string>{std::span{storage}.first(storage.size() - 1), 4}), std::invalid_argument);
+        CHECK_THROWS_AS((lock_free::SpscRing<std::string>{std::span{storage}.subspan(8), 2}), std::invalid_argument); // misaligned
+    }
+}
+
+TEST_CASE("SpscRing - attached to existing storage")
+{
+    // storage as it would be mapped in shared memory - positions and capacity live in it, not in the queue objects
+    alignas(lock_free::cache_line_size) std::array<std::byte, lock_free::SpscRing<int>::storage_size(8)> shared;
+
+    lock_free::SpscRing<int> producer{shared, 8};
+    CHECK(producer.try_push(1));
+    CHECK(producer.try_push(2));
+
+    lock_free::SpscRing<int> consumer{lock_free::attach, shared}; // does not reset the ring
+    CHECK(consumer.capacity() == 8);
+    CHECK(consumer.size() == 2);
+    CHECK(consumer.try_pop() == 1);
+
+    CHECK(producer.try_push(3));
+    CHECK(consumer.try_pop() == 2);
+    CHECK(consumer.try_pop() == 3);
+    CHECK(producer.empty());
+
+    std::array<std::byte, 32> too_small{};
+    CHECK_THROWS_AS((lock_free::SpscRing<int>{lock_free::attach, too_small}), std::invalid_argument);
+}
+
+TEST_CASE("SpscRing - producer & consumer threads")
+{
+    constexpr int count = 200'000;
+    lock_free::SpscRing<int> ring{64};
+
+    long long sum = 0;
+    std::thread consumer{[&] {
+        std::array<int, 16> batch;
+        for (int received = 0; received < count;)
+        {
+            const size_t popped = ring.pop(batch);
+            for (size_t i = 0; i < popped; ++i)
+            {
+                if (batch[i] != received + static_cast<int>(i)) // FIFO
+                    sum = -1;
+                sum += batch[i];
+            }
+            received += static_cast<int>(popped);
+            if (popped == 0)
+                std::this_thread::yield();
+        }
+    }};
+
+    for (int i = 0; i < count; ++i)
+        while (!ring.try_push(i))
+            std::this_thread::yield();
+
+    consumer.join();
+
+    CHECK(sum == static_cast<long long>(count) * (count - 1) / 2);
+}
+
+TEST_CASE("MpmcQueue")
+{
+    alignas(lock_free::cache_line_size) std::array<std::byte, lock_free::MpmcQueue<int>::storage_size(8)> storage;
+    lock_free::MpmcQueue<int> queue{storage, 8};
+
+    CHECK(queue.capacity() == 8);
+    CHECK_FALSE(queue.try_pop().has_value());
+
+    for (int i = 0; i < 8; ++i)
+        CHECK(queue.try_push(i));
+    CHECK_FALSE(queue.try_push(8));
+
+    for (int i = 0; i < 8; ++i)
+        CHECK(queue.try_pop() == i);
+    CHECK_FALSE(queue.try_pop().has_value());
+
+    CHECK_THROWS_AS(lock_free::MpmcQueue<int>{100}, std::invalid_argument);
+
+    SECTION("attached to existing storage")
+    {
+        CHECK(queue.try_push(10));
+
+        lock_free::MpmcQueue<int> attached{lock_free::attach, storage}; // cells keep their sequences
+        CHECK(attached.capacity() == 8);
+        CHECK(attached.try_push(11));
+        CHECK(attached.try_pop() == 10);
+        CHECK(queue.try_pop() == 11);
+        CHECK_FALSE(attached.try_pop().has_value());
+    }
+}
+
+TEST_CASE("MpmcQueue - many producers & consumers")
+{
+    constexpr int producers = 4;
+    constexpr int consumers = 3;
+    constexpr int per_producer = 50'000;
+
+    lock_free::MpmcQueue<int> queue{256};
+    std::vector<std::vector<int>> received(consumers);
+    std::atomic<int> remaining = producers * per_producer;
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (int p = 0; p < producers; ++p)
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < per_producer; ++i)
+                    while (!queue.try_push(p * per_producer + i))
+                        std::this_thread::yield();
+            });
+
+        for (int c = 0; c < consumers; ++c)
+            threads.emplace_back([&, c] {
+                while (remaining.load() > 0)
+                {
+                    if (auto item = queue.try_pop())
+                    {
+                        received[c].push_back(*item);
+                        --remaining;
+                    }
+                    else
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    std::vector<int> all;
+    for (const auto& items : received)
+        all.insert(all.end(), items.begin(), items.end());
+    std::ranges::sort(all);
+
+    std::vector<int> expected(producers * per_producer);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    CHECK(all == expected); // every item exactly once
+}
@@ -0,0 +1,218 @@
+#ifndef READ_MOSTLY_HPP
+#define READ_MOSTLY_HPP
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+// Alternatives to one std::mutex guarding shared data ("mutex + data" in small_features.cpp):
+//  - ReadMostly<T> - readers get immutable snapshots without locks, writers copy, modify and publish a new snapshot
+//  - ShardedMap<K, V> - write-heavy maps; keys are spread over independently locked shards
+namespace concurrent
+{
+    inline constexpr size_t cache_line_size = 64;
+
+    template <typename T>
+    class ReadMostly
+    {
+    public:
+        using Snapshot = std::shared_ptr<const T>;
+
+        // per-thread handle - caches the snapshot and reloads it only when the version changes,
+        // so a read is one load of a counter nobody writes to between updates (scales with readers);
+        // keeps the cached snapshot alive until the next get()
+        class Reader
+        {
+        public:
+            explicit Reader(const ReadMostly& source)
+                : source_{&source}
+            {
+            }
+
+            const T& get()
+            {
+                const std::uint64_t version = source_->version_.load(std::memory_order_acquire);
+                if (version != version_)
+                {
+                    cached_ = source_->current_.load(std::memory_order_acquire); // at least as new as version
+                    version_ = version;
+                }
+                return *cached_;
+            }
+
+            const T& operator*()
+            {
+                return get();
+            }
+
+            const T* operator->()
+            {
+                return &get();
+            }
+
+        private:
+            const ReadMostly* source_;
+            Snapshot cached_;
+            std::uint64_t version_ = 0; // ReadMostly starts at 1
+        };
+
+        explicit ReadMostly(T value = T{})
+            : current_{std::make_shared<const T>(std::move(value))}
+        {
+        }
+
+        ReadMostly(const ReadMostly&) = delete;
+        ReadMostly& operator=(const ReadMostly&) = delete;
+
+        // consistent view - unaffected by later updates
+        Snapshot snapshot() const
+        {
+            return current_.load(std::memory_order_acquire);
+        }
+
+        Reader reader() const
+        {
+            return Reader{*this};
+        }
+
+        std::uint64_t version() const noexcept
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+
+        void store(T value)
+        {
+            std::scoped_lock lk{write_mtx_};
+            publish(std::make_shared<const T>(std::move(value)));
+        }
+
+        // copy-on-write - modifier(T&) works on a private copy; writers are serialized, readers are never blocked
+        template <std::invocable<T&> TModifier>
+        void update(TModifier&& modifier)
+        {
+            std::scoped_lock lk{write_mtx_};
+            auto copy = std::make_shared<T>(*current_.load(std::memory_order_relaxed));
+            std::invoke(std::forward<TModifier>(modifier), *copy);
+            publish(std::move(copy));
+        }
+
+    private:
+        std::atomic<Snapshot> current_;
+        alignas(cache_line_size) std::atomic<std::uint64_t> version_{1}; // read by every Reader::get()
+        alignas(cache_line_size) std::mutex write_mtx_;
+
+        void publish(Snapshot snapshot)
+        {
+            current_.store(std::move(snapshot), std::memory_order_release);
+            version_.fetch_add(1, std::memory_order_release); // after the pointer - readers never cache a stale one
+        }
+    };
+
+    // hash map split into Shards independently locked maps - writers to different shards do not contend
+    template <typename TKey, typename TValue, typename THash = std::hash<TKey>, size_t Shards = 16>
+    class ShardedMap
+    {
+        static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "number of shards must be a power of two");
+
+    public:
+        void insert_or_assign(const TKey& key, TValue value)
+        {
+            auto& s = shard_for(key);
+            std::scoped_lock lk{s.mtx};
+            s.items.insert_or_assign(key, std::move(value));
+        }
+
+        bool erase(const TKey& key)
+        {
+            auto& s = shard_for(key);
+            std::scoped_lock lk{s.mtx};
+            return s.items.erase(key) > 0;
+        }
+
+        // returns a copy - references would outlive the lock
+        std::optional<TValue> find(const TKey& key) const
+        {
+            const auto& s = shard_for(key);
+            std::scoped_lock lk{s.mtx};
+            if (auto it = s.items.find(key); it != s.items.end())
+                return it->second;
+            return std::nullopt;
+        }
+
+        bool contains(const TKey& key) const
+        {
+            const auto& s = shard_for(key);
+            std::scoped_lock lk{s.mtx};
+            return s.items.contains(key);
+        }
+
+        // modifier(TValue&) runs under the shard lock; a missing value is value-initialized
+        template <std::invocable<TValue&> TModifier>
+        void update(const TKey& key, TModifier&& modifier)
+        {
+            auto& s = shard_for(key);
+            std::scoped_lock lk{s.mtx};
+            std::invoke(std::forward<TModifier>(modifier), s.items[key]);
+        }
+
+        // not a snapshot - shards are counted one after another
+        size_t size() const
+        {
+            size_t result = 0;
+            for (const auto& s : shards_)
+            {
+                std::scoped_lock lk{s.mtx};
+                result += s.items.size();
+            }
+            return result;
+        }
+
+        // f(key, value) for every item - shard by shard, each under its lock
+        template <std::invocable<const TKey&, const TValue&> TFunction>
+        void for_each(TFunction&& f) const
+        {
+            for (const auto& s : shards_)
+            {
+                std::scoped_lock lk{s.mtx};
+                for (const auto& [key, value] : s.items)
+                    std::invoke(f, key, value);
+            }
+        }
+
+    private:
+        struct alignas(cache_line_size) Shard
+        {
+            mutable std::mutex mtx; // write-heavy - std::shared_mutex costs more than it saves
+            std::unordered_map<TKey, TValue, THash> items;
+        };
+
+        std::array<Shard, Shards> shards_;
+
+        // top bits of a mixed hash - the map inside a shard uses the low ones
+        static size_t shard_index(const TKey& key)
+        {
+            const std::uint64_t hash = static_cast<std::uint64_t>(THash{}(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(hash >> 32) & (Shards - 1);
+        }
+
+        Shard& shard_for(const TKey& key)
+        {
+            return shards_[shard_index(key)];
+        }
+
+        const Shard& shard_for(const TKey& key) const
+        {
+            return shards_[shard_index(key)];
+        }
+    };
+} // namespace concurrent
+
+#endif
@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "read_mostly.hpp"
+
+TEST_CASE("ReadMostly - snapshots")
+{
+    concurrent::ReadMostly<std::vector<int>> data{{1, 2, 3}};
+
+    auto before = data.snapshot();
+    data.update([](std::vector<int>& vec) {
+        for (auto& item : vec)
+            item *= 2;
+    });
+
+    CHECK(*before == std::vector{1, 2, 3}); // old snapshot is immutable
+    CHECK(*data.snapshot() == std::vector{2, 4, 6});
+
+    SECTION("reader caches until the next update")
+    {
+        auto reader = data.reader();
+        const std::vector<int>* first = &reader.get();
+        CHECK(&reader.get() == first);
+
+        data.store({42});
+        CHECK(reader->size() == 1);
+        CHECK(reader.get()[0] == 42);
+    }
+}
+
+TEST_CASE("ReadMostly - readers see only complete states")
+{
+    // invariant: all items are equal
+    concurrent::ReadMostly<std::vector<int>> data{std::vector<int>(64, 0)};
+    std::atomic<bool> done = false;
+    std::atomic<int> broken = 0;
+
+    {
+        std::vector<std::jthread> readers;
+        for (int i = 0; i < 3; ++i)
+            readers.emplace_back([&] {
+                auto reader = data.reader();
+                while (!done)
+                {
+                    const auto& vec = reader.get();
+                    if (std::ranges::count(vec, vec.front()) != std::ssize(vec))
+                        ++broken;
+                    std::this_thread::yield();
+                }
+            });
+
+        for (int version = 1; version <= 1000; ++version)
+            data.update([](auto& vec) { std::ranges::for_each(vec, [](int& x) { ++x; }); });
+        done = true;
+    }
+
+    CHECK(broken == 0);
+    CHECK(data.snapshot()->front() == 1000);
+}
+
+TEST_CASE("ShardedMap")
+{
+    concurrent::ShardedMap<std::string, int> map;
+
+    map.insert_or_assign("one", 1);
+    map.insert_or_assign("two", 2);
+    map.insert_or_assign("one", 11);
+
+    CHECK(map.size() == 2);
+    CHECK(map.find("one") == 11);
+    CHECK_FALSE(map.find("three").has_value());
+    CHECK(map.erase("two"));
+    CHECK_FALSE(map.contains("two"));
+
+    SECTION("concurrent updates")
+    {
+        {
+            std::vector<std::jthread> writers;
+            for (int t = 0; t < 4; ++t)
+                writers.emplace_back([&] {
+                    for (int i = 0; i < 10'000; ++i)
+                        map.update("counter-" + std::to_string(i % 100), [](int& counter) { ++counter; });
+                });
+        }
+
+        int total = 0;
+        map.for_each([&](const std::string& key, int value) {
+            if (key.starts_with("counter-"))
+                total += value;
+        });
+
+        CHECK(map.size() == 101);
+        CHECK(total == 40'000);
+    }
+}
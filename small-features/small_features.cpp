@@ -7,6 +7,8 @@
 #include <vector>
 #include <source_location>
 
+#include "read_mostly.hpp"
+
 using namespace std::literals;
 
 [[nodiscard("Always check if data was loaded")]] std::optional<std::vector<int>> load_data(const std::string& path)
@@ -57,6 +59,22 @@ TEST_CASE("range-based for with init")
             std::cout << index << "th: " << *it << "\n";
         }
     }
+
+    SECTION("read-mostly data - snapshot instead of a lock")
+    {
+        static concurrent::ReadMostly<std::vector<int>> vec{{1, 2, 3}};
+
+        vec.update([](auto& items) {
+            for (auto& item : items)
+                item *= 2;
+        });
+
+        for (auto snapshot = vec.snapshot(); const auto& item : *snapshot)
+        {
+            std::cout << item << " ";
+        }
+        std::cout << "\n";
+    }
 }
 
 enum class DayOfWeek { mon, tue, wed, thd, fri, sat, sun };
@@ -0,0 +1,400 @@
+#ifndef ALIGNED_HPP
+#define ALIGNED_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#define ALIGNED_HAS_MMAP 1
+#include <sys/mman.h>
+#endif
+
+// Spans in std_lib_cpp20.cpp point to memory of unknown alignment - a vectorized kernel has to peel
+// scalar iterations until the first aligned address. aligned_span carries the alignment in its type:
+// it is checked once when the span is created and data() returns std::assume_aligned<Align>(ptr),
+// so kernels taking an aligned_span get aligned loads without runtime checks.
+
+namespace aligned
+{
+    template <size_t Align>
+    concept ValidAlignment = std::has_single_bit(Align);
+
+    inline bool is_aligned(const void* ptr, size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+    }
+
+    template <typename T, size_t Align>
+        requires ValidAlignment<Align> && (Align >= alignof(T))
+    class aligned_span
+    {
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using iterator = T*;
+
+        static constexpr size_t alignment = Align;
+
+        constexpr aligned_span() = default;
+
+        // checked - throws std::invalid_argument for misaligned data
+        explicit aligned_span(std::span<T> items)
+            : data_{items.data()}
+            , size_{items.size()}
+        {
+            if (!is_aligned(data_, Align))
+                throw std::invalid_argument("span is not aligned to the required boundary");
+        }
+
+        aligned_span(T* data, size_t size)
+            : aligned_span{std::span<T>{data, size}}
+        {
+        }
+
+        // aligned_span<const int, 64> c = aligned; aligned_span<int, 16> weaker = aligned;
+        template <typename U, size_t OtherAlign>
+            requires std::convertible_to<U (*)[], T (*)[]> && (OtherAlign >= Align)
+        constexpr aligned_span(const aligned_span<U, OtherAlign>& other) noexcept
+            : data_{other.data()}
+            , size_{other.size()}
+        {
+        }
+
+        T* data() const noexcept
+        {
+            return std::assume_aligned<Align>(data_);
+        }
+
+        constexpr size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        constexpr size_t size_bytes() const noexcept
+        {
+            return size_ * sizeof(T);
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        T& operator[](size_t index) const
+        {
+            return data()[index];
+        }
+
+        iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        // the beginning stays aligned
+        aligned_span first(size_t count) const
+        {
+            if (count > size_)
+                throw std::out_of_range("count exceeds span size");
+            return aligned_span{data_, count, Unchecked{}};
+        }
+
+        // checked - offset * sizeof(T) must be a multiple of Align
+        aligned_span subspan(size_t offset, size_t count = std::dynamic_extent) const
+        {
+            if (offset > size_)
+                throw std::out_of_range("offset exceeds span size");
+            return aligned_span{std::span<T>{data_, size_}.subspan(offset, count)};
+        }
+
+    private:
+        T* data_ = nullptr;
+        size_t size_ = 0;
+
+        struct Unchecked
+        {
+        };
+
+        constexpr aligned_span(T* data, size_t size, Unchecked)
+            : data_{data}
+            , size_{size}
+        {
+        }
+    };
+} // namespace aligned
+
+// std::span<int> s = aligned; - uses the range constructor of std::span
+template <typename T, size_t Align>
+inline constexpr bool std::ranges::enable_borrowed_range<aligned::aligned_span<T, Align>> = true;
+
+namespace aligned
+{
+    // unaligned head, aligned body (whole multiples of Align bytes where possible) and tail
+    template <size_t Align, typename T>
+    struct AlignedSplit
+    {
+        std::span<T> head;
+        aligned_span<T, Align> body;
+        std::span<T> tail;
+    };
+
+    // peel loop done once for any span: kernel(head) scalar, kernel(body) vectorized, kernel(tail) scalar
+    template <size_t Align, typename T>
+    AlignedSplit<Align, T> align_split(std::span<T> items)
+    {
+        static_assert(Align % sizeof(T) == 0 || sizeof(T) % Align == 0, "element size must be compatible with the alignment");
+
+        const auto address = reinterpret_cast<std::uintptr_t>(items.data());
+        const size_t misalignment = (Align - address % Align) % Align;
+
+        const size_t head_size = misalignment / sizeof(T);
+        const size_t per_block = std::max<size_t>(Align / sizeof(T), 1);
+
+        if (misalignment % sizeof(T) != 0 || head_size + per_block > items.size()) // elements never meet the boundary or too short
+            return {items, {}, {}};
+
+        const size_t body_size = (items.size() - head_size) / per_block * per_block;
+
+        return {items.first(head_size), aligned_span<T, Align>{items.subspan(head_size, body_size)}, items.subspan(head_size + body_size)};
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // storage
+
+    // std::allocator with stronger alignment - usable with std::vector as well
+    template <typename T, size_t Align>
+        requires ValidAlignment<Align> && (Align >= alignof(T))
+    struct aligned_allocator
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = aligned_allocator<U, Align>;
+        };
+
+        aligned_allocator() = default;
+
+        template <typename U>
+        constexpr aligned_allocator(const aligned_allocator<U, Align>&) noexcept
+        {
+        }
+
+        T* allocate(size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Align}));
+        }
+
+        void deallocate(T* ptr, size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t{Align});
+        }
+
+        friend bool operator==(const aligned_allocator&, const aligned_allocator&) = default;
+    };
+
+    enum class PageSize
+    {
+        normal,
+        huge // MAP_HUGETLB if huge pages are reserved, otherwise transparent huge pages (madvise); normal pages without mmap
+    };
+
+    // fixed-size, move-only array of value-initialized items aligned to Align
+    template <typename T, size_t Align = 64>
+        requires ValidAlignment<Align> && (Align >= alignof(T))
+    class aligned_buffer
+    {
+    public:
+        static constexpr size_t alignment = Align;
+        static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+        explicit aligned_buffer(size_t size, PageSize page_size = PageSize::normal)
+            : size_{size}
+        {
+            allocate(page_size);
+            try
+            {
+                std::uninitialized_value_construct_n(data_, size_);
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+        }
+
+        aligned_buffer(size_t size, const T& value, PageSize page_size = PageSize::normal)
+            : size_{size}
+        {
+            allocate(page_size);
+            try
+            {
+                std::uninitialized_fill_n(data_, size_, value);
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+        }
+
+        aligned_buffer(const aligned_buffer&) = delete;
+        aligned_buffer& operator=(const aligned_buffer&) = delete;
+
+        aligned_buffer(aligned_buffer&& other) noexcept
+            : data_{std::exchange(other.data_, nullptr)}
+            , size_{std::exchange(other.size_, 0)}
+            , mapped_size_{std::exchange(other.mapped_size_, 0)}
+            , huge_pages_{std::exchange(other.huge_pages_, false)}
+        {
+        }
+
+        aligned_buffer& operator=(aligned_buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                mapped_size_ = std::exchange(other.mapped_size_, 0);
+                huge_pages_ = std::exchange(other.huge_pages_, false);
+            }
+            return *this;
+        }
+
+        ~aligned_buffer()
+        {
+            destroy();
+        }
+
+        T* data() const noexcept
+        {
+            return std::assume_aligned<Align>(data_);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        T& operator[](size_t index) const
+        {
+            return data()[index];
+        }
+
+        T* begin() const noexcept
+        {
+            return data();
+        }
+
+        T* end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        // true if memory was mapped with huge pages requested (MAP_HUGETLB or MADV_HUGEPAGE)
+        bool uses_huge_pages() const noexcept
+        {
+            return huge_pages_;
+        }
+
+        aligned_span<T, Align> span() const
+        {
+            return aligned_span<T, Align>{std::span<T>{data_, size_}};
+        }
+
+        // aligned_span<const float, 64> view = buffer; std::span<float> s = buffer; uses the range constructor
+        template <typename U, size_t OtherAlign>
+            requires std::convertible_to<T (*)[], U (*)[]> && (OtherAlign <= Align)
+        operator aligned_span<U, OtherAlign>() const
+        {
+            return span();
+        }
+
+    private:
+        T* data_ = nullptr;
+        size_t size_ = 0;
+        size_t mapped_size_ = 0; // != 0 - memory comes from mmap
+        bool huge_pages_ = false;
+
+        void allocate([[maybe_unused]] PageSize page_size)
+        {
+            if (size_ == 0)
+                return;
+
+#ifdef ALIGNED_HAS_MMAP
+            if (page_size == PageSize::huge && Align <= huge_page_size)
+            {
+                const size_t bytes = (size_ * sizeof(T) + huge_page_size - 1) / huge_page_size * huge_page_size;
+
+#ifdef MAP_HUGETLB
+                void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#else
+                void* ptr = MAP_FAILED;
+#endif
+                if (ptr == MAP_FAILED) // no reserved huge pages - ask for transparent ones
+                {
+                    ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+                    if (ptr != MAP_FAILED)
+                        ::madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+                }
+
+                if (ptr != MAP_FAILED)
+                {
+                    data_ = static_cast<T*>(ptr);
+                    mapped_size_ = bytes;
+                    huge_pages_ = true;
+                    return;
+                }
+            }
+#endif
+
+            data_ = aligned_allocator<T, Align>{}.allocate(size_);
+        }
+
+        void release() noexcept
+        {
+            if (!data_)
+                return;
+
+#ifdef ALIGNED_HAS_MMAP
+            if (mapped_size_ != 0)
+                ::munmap(data_, mapped_size_);
+            else
+#endif
+                aligned_allocator<T, Align>{}.deallocate(data_, size_);
+
+            data_ = nullptr;
+        }
+
+        void destroy() noexcept
+        {
+            if (data_)
+                std::destroy_n(data_, size_);
+            release();
+        }
+    };
+} // namespace aligned
+
+#endif
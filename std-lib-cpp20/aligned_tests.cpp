@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aligned.hpp"
+
+namespace
+{
+    // aligned loads only - no peel loop generated for the body
+    float sum(aligned::aligned_span<const float, 32> items)
+    {
+        float result = 0.0f;
+        for (float item : items)
+            result += item;
+        return result;
+    }
+
+    float sum_any(std::span<const float> items)
+    {
+        auto [head, body, tail] = aligned::align_split<32>(items);
+
+        float result = 0.0f;
+        for (float item : head)
+            result += item;
+        result += sum(body);
+        for (float item : tail)
+            result += item;
+        return result;
+    }
+} // namespace
+
+TEST_CASE("aligned_buffer")
+{
+    aligned::aligned_buffer<float, 64> buffer(1000);
+
+    CHECK(buffer.size() == 1000);
+    CHECK(aligned::is_aligned(buffer.data(), 64));
+    CHECK(std::ranges::all_of(buffer, [](float x) { return x == 0.0f; }));
+    CHECK_FALSE(buffer.uses_huge_pages());
+
+    SECTION("fill value")
+    {
+        aligned::aligned_buffer<std::string, 128> words(3, "text");
+
+        CHECK(aligned::is_aligned(words.data(), 128));
+        CHECK(std::ranges::all_of(words, [](const auto& w) { return w == "text"; }));
+    }
+
+    SECTION("huge pages")
+    {
+        aligned::aligned_buffer<std::uint64_t, 4096> big(3 * 1024 * 1024, aligned::PageSize::huge);
+
+#ifdef ALIGNED_HAS_MMAP
+        CHECK(big.uses_huge_pages());
+#else
+        CHECK_FALSE(big.uses_huge_pages()); // aligned operator new fallback
+#endif
+        CHECK(aligned::is_aligned(big.data(), 4096));
+        CHECK(big[big.size() - 1] == 0);
+    }
+
+    SECTION("move")
+    {
+        const float* data = buffer.data();
+        aligned::aligned_buffer<float, 64> other = std::move(buffer);
+
+        CHECK(other.data() == data);
+        CHECK(other.size() == 1000);
+        CHECK(buffer.empty());
+    }
+
+    SECTION("allocator for std::vector")
+    {
+        std::vector<double, aligned::aligned_allocator<double, 64>> vec(17);
+
+        CHECK(aligned::is_aligned(vec.data(), 64));
+    }
+}
+
+TEST_CASE("aligned_span")
+{
+    aligned::aligned_buffer<float, 64> buffer(100);
+    std::iota(buffer.begin(), buffer.end(), 1.0f);
+
+    SECTION("conversions from the buffer")
+    {
+        aligned::aligned_span<float, 64> all = buffer;
+        aligned::aligned_span<const float, 32> weaker = buffer;
+        std::span<float> plain = buffer;
+
+        CHECK(all.size() == 100);
+        CHECK(weaker.data() == buffer.data());
+        CHECK(plain.data() == buffer.data());
+
+        CHECK(sum(buffer) == 5050.0f);
+    }
+
+    SECTION("to std::span")
+    {
+        aligned::aligned_span<float, 64> all = buffer;
+        std::span<const float> items = all;
+
+        CHECK(items.size() == 100);
+        CHECK(std::ranges::equal(std::span{all}, items));
+    }
+
+    SECTION("from std::span - alignment is checked")
+    {
+        std::span<float> items = buffer;
+
+        CHECK(aligned::aligned_span<float, 64>{items}.size() == 100);
+        CHECK(aligned::aligned_span<float, 16>{items.subspan(4)}.size() == 96);
+        CHECK_THROWS_AS((aligned::aligned_span<float, 64>{items.subspan(1)}), std::invalid_argument);
+    }
+
+    SECTION("subspans")
+    {
+        aligned::aligned_span<float, 64> all = buffer;
+
+        CHECK(all.first(10).size() == 10);
+        CHECK(all.subspan(16, 8)[0] == 17.0f);
+        CHECK_THROWS_AS(all.subspan(3), std::invalid_argument);
+        CHECK_THROWS_AS(all.first(101), std::out_of_range);
+    }
+}
+
+TEST_CASE("align_split")
+{
+    aligned::aligned_buffer<float, 64> buffer(100);
+    std::iota(buffer.begin(), buffer.end(), 1.0f);
+    const std::span<const float> items = buffer;
+
+    for (size_t offset : {0u, 1u, 5u, 8u, 9u})
+        for (size_t size : {0u, 3u, 8u, 50u, 91u})
+        {
+            auto [head, body, tail] = aligned::align_split<32>(items.subspan(offset, size));
+
+            CHECK(head.size() + body.size() + tail.size() == size);
+            CHECK(body.size() % 8 == 0);
+            CHECK(tail.size() < 8);
+            CHECK((body.empty() || aligned::is_aligned(body.data(), 32)));
+        }
+
+    CHECK(sum_any(items.subspan(3, 90)) == std::accumulate(items.begin() + 3, items.begin() + 93, 0.0f));
+}
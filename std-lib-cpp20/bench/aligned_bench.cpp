@@ -0,0 +1,98 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <cstdint>
+#include <immintrin.h>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "aligned.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    void saxpy(float a, std::span<const float> x, std::span<float> y)
+    {
+        for (size_t i = 0; i < y.size(); ++i)
+            y[i] = a * x[i] + y[i];
+    }
+
+    // unknown alignment - unaligned loads
+    void saxpy_sse(float a, std::span<const float> x, std::span<float> y)
+    {
+        const __m128 factor = _mm_set1_ps(a);
+        size_t i = 0;
+        for (; i + 4 <= y.size(); i += 4)
+            _mm_storeu_ps(&y[i], _mm_add_ps(_mm_mul_ps(factor, _mm_loadu_ps(&x[i])), _mm_loadu_ps(&y[i])));
+        for (; i < y.size(); ++i)
+            y[i] = a * x[i] + y[i];
+    }
+
+    // alignment known from the type - aligned loads without a check or a peel loop
+    void saxpy_sse(float a, aligned::aligned_span<const float, 64> x, aligned::aligned_span<float, 64> y)
+    {
+        const float* in = x.data();
+        float* out = y.data();
+        const __m128 factor = _mm_set1_ps(a);
+        size_t i = 0;
+        for (; i + 4 <= y.size(); i += 4)
+            _mm_store_ps(out + i, _mm_add_ps(_mm_mul_ps(factor, _mm_load_ps(in + i)), _mm_load_ps(out + i)));
+        for (; i < y.size(); ++i)
+            out[i] = a * in[i] + out[i];
+    }
+} // namespace
+
+HELPERS_BENCHMARK("aligned - saxpy, 4096 floats (L1/L2)")
+{
+    aligned::aligned_buffer<float, 64> x(4096, 1.0f);
+    aligned::aligned_buffer<float, 64> y(4096, 2.0f);
+
+    bench.run("std::span - compiler", [&] {
+        saxpy(0.5f, std::span<const float>{x}, std::span<float>{y});
+        do_not_optimize(y[0]);
+    });
+
+    bench.run("std::span - SSE loadu", [&] {
+        saxpy_sse(0.5f, std::span<const float>{x}, std::span<float>{y});
+        do_not_optimize(y[0]);
+    });
+
+    bench.run("std::span - SSE loadu, misaligned by 4 bytes", [&] {
+        saxpy_sse(0.5f, std::span<const float>{x}.subspan(1), std::span<float>{y}.subspan(1));
+        do_not_optimize(y[0]);
+    });
+
+    bench.run("aligned_span - SSE load", [&] {
+        saxpy_sse(0.5f, x.span(), y.span());
+        do_not_optimize(y[0]);
+    });
+}
+
+HELPERS_BENCHMARK("aligned - random reads, 1 GiB (TLB)")
+{
+    constexpr size_t size = 1024 * 1024 * 1024 / sizeof(std::uint64_t);
+
+    std::vector<std::uint32_t> indexes(1 << 20);
+    helpers::random::PCG rnd{42};
+    for (auto& index : indexes)
+        index = static_cast<std::uint32_t>(rnd() % size);
+
+    auto gather = [&](const auto& buffer) {
+        std::uint64_t result = 0;
+        for (auto index : indexes)
+            result += buffer[index];
+        return result;
+    };
+
+    {
+        aligned::aligned_buffer<std::uint64_t, 64> normal(size, 1);
+        bench.run("4 KiB pages", [&] { do_not_optimize(gather(normal)); });
+    }
+
+    {
+        aligned::aligned_buffer<std::uint64_t, 64> huge(size, 1, aligned::PageSize::huge);
+        bench.run("huge pages", [&] { do_not_optimize(gather(huge)); });
+    }
+}
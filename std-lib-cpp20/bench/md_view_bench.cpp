@@ -0,0 +1,73 @@
+#include <benchmark.hpp>
+
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "md_view.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr size_t matrix_size = 8 * 1024; // 8k x 8k floats - 256 MiB per matrix
+
+    std::vector<float> create_matrix()
+    {
+        std::vector<float> data(matrix_size * matrix_size);
+        std::iota(data.begin(), data.end(), 0.0f);
+        return data;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("md - transpose 8k x 8k floats")
+{
+    const auto data = create_matrix();
+    std::vector<float> transposed(data.size());
+
+    md::mdspan source{data.data(), matrix_size, matrix_size};
+    md::mdspan destination{transposed.data(), matrix_size, matrix_size};
+
+    bench.run("naive", [&] {
+        md::transpose(source, destination);
+        do_not_optimize(transposed);
+    });
+
+    for (size_t tile : {8, 16, 32, 64, 128})
+    {
+        bench.run("blocked - tile " + std::to_string(tile), [&] {
+            md::transpose_blocked(source, destination, tile);
+            do_not_optimize(transposed);
+        });
+    }
+}
+
+HELPERS_BENCHMARK("md - reductions 8k x 8k floats")
+{
+    const auto data = create_matrix();
+    std::vector<double> sums(matrix_size);
+
+    md::mdspan matrix{data.data(), matrix_size, matrix_size};
+
+    bench.run("row sums", [&] {
+        md::sum_rows(matrix, std::span{sums});
+        do_not_optimize(sums);
+    });
+
+    bench.run("column sums - naive, column by column", [&] {
+        for (size_t j = 0; j < matrix.extent(1); ++j)
+        {
+            double sum = 0.0;
+            for (size_t i = 0; i < matrix.extent(0); ++i)
+                sum += matrix(i, j);
+            sums[j] = sum;
+        }
+        do_not_optimize(sums);
+    });
+
+    bench.run("column sums - md::sum_cols, memory order", [&] {
+        md::sum_cols(matrix, std::span{sums});
+        do_not_optimize(sums);
+    });
+}
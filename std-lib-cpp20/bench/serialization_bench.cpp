@@ -0,0 +1,50 @@
+#include <benchmark.hpp>
+
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "serialization.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+HELPERS_BENCHMARK("serialization - 64 MiB of floats")
+{
+    std::vector<float> samples(64 * 1024 * 1024 / sizeof(float));
+    std::iota(samples.begin(), samples.end(), 0.0f);
+
+    std::vector<std::byte> buffer(samples.size() * sizeof(float) + 4096);
+
+    bench.run("memcpy - baseline", [&] {
+        std::memcpy(buffer.data(), samples.data(), samples.size() * sizeof(float));
+        do_not_optimize(buffer);
+    });
+
+    bench.run("item by item", [&] {
+        std::byte* out = buffer.data();
+        for (float sample : samples)
+        {
+            auto bytes = std::as_bytes(std::span{&sample, 1});
+            out = std::copy(bytes.begin(), bytes.end(), out);
+        }
+        do_not_optimize(buffer);
+    });
+
+    bench.run("Writer::write_to", [&] {
+        serialization::Writer writer;
+        writer.add(std::span{samples});
+        do_not_optimize(writer.write_to(buffer));
+    });
+
+    const auto message = [&] {
+        serialization::Writer writer;
+        writer.add(std::span{samples});
+        return writer.serialize();
+    }();
+
+    bench.run("Reader::field - zero-copy", [&] {
+        serialization::Reader reader{message};
+        do_not_optimize(reader.field<float>(0));
+    });
+}
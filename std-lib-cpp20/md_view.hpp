@@ -0,0 +1,477 @@
+#ifndef MD_VIEW_HPP
+#define MD_VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Subset of C++23 std::mdspan for C++20 - same names and semantics, but:
+//  * only dynamic extents - md::dextents<Rank>,
+//  * elements are accessed with operator()(i, j, ...) - multidimensional operator[] is C++23,
+//  * submdspan() always returns a layout_stride view.
+namespace md
+{
+    template <size_t Rank>
+    class dextents
+    {
+    public:
+        constexpr dextents() = default;
+
+        template <std::convertible_to<size_t>... TExtents>
+            requires(sizeof...(TExtents) == Rank)
+        constexpr dextents(TExtents... extents)
+            : extents_{static_cast<size_t>(extents)...}
+        {
+        }
+
+        constexpr dextents(const std::array<size_t, Rank>& extents)
+            : extents_{extents}
+        {
+        }
+
+        static constexpr size_t rank()
+        {
+            return Rank;
+        }
+
+        constexpr size_t extent(size_t r) const
+        {
+            return extents_[r];
+        }
+
+        constexpr size_t size() const
+        {
+            size_t result = 1;
+            for (size_t e : extents_)
+                result *= e;
+            return result;
+        }
+
+        friend constexpr bool operator==(const dextents&, const dextents&) = default;
+
+    private:
+        std::array<size_t, Rank> extents_{};
+    };
+
+    namespace details
+    {
+        // every layout is a linear combination of indexes - layouts differ only in how strides are chosen
+        template <typename TExtents>
+        class strided_mapping
+        {
+        public:
+            using extents_type = TExtents;
+            using strides_type = std::array<size_t, TExtents::rank()>;
+
+            constexpr strided_mapping(const extents_type& extents, const strides_type& strides)
+                : extents_{extents}
+                , strides_{strides}
+            {
+            }
+
+            constexpr const extents_type& extents() const
+            {
+                return extents_;
+            }
+
+            constexpr size_t stride(size_t r) const
+            {
+                return strides_[r];
+            }
+
+            constexpr const strides_type& strides() const
+            {
+                return strides_;
+            }
+
+            template <std::convertible_to<size_t>... TIndexes>
+                requires(sizeof...(TIndexes) == TExtents::rank())
+            constexpr size_t operator()(TIndexes... indexes) const
+            {
+                return [&]<size_t... Rs>(std::index_sequence<Rs...>) {
+                    return ((static_cast<size_t>(indexes) * strides_[Rs]) + ... + 0);
+                }(std::index_sequence_for<TIndexes...>{});
+            }
+
+            constexpr size_t required_span_size() const
+            {
+                size_t result = 1;
+                for (size_t r = 0; r < TExtents::rank(); ++r)
+                {
+                    if (extents_.extent(r) == 0)
+                        return 0;
+                    result += (extents_.extent(r) - 1) * strides_[r];
+                }
+                return result;
+            }
+
+            // no gaps between elements
+            constexpr bool is_exhaustive() const
+            {
+                return required_span_size() == extents_.size();
+            }
+
+        private:
+            extents_type extents_;
+            strides_type strides_;
+        };
+    } // namespace details
+
+    // row-major (C) - the last index is contiguous
+    struct layout_right
+    {
+        template <typename TExtents>
+        class mapping : public details::strided_mapping<TExtents>
+        {
+        public:
+            constexpr mapping(const TExtents& extents)
+                : details::strided_mapping<TExtents>{extents, strides_for(extents)}
+            {
+            }
+
+        private:
+            static constexpr auto strides_for(const TExtents& extents)
+            {
+                std::array<size_t, TExtents::rank()> strides{};
+                size_t stride = 1;
+                for (size_t r = TExtents::rank(); r-- > 0;)
+                {
+                    strides[r] = stride;
+                    stride *= extents.extent(r);
+                }
+                return strides;
+            }
+        };
+    };
+
+    // column-major (Fortran) - the first index is contiguous
+    struct layout_left
+    {
+        template <typename TExtents>
+        class mapping : public details::strided_mapping<TExtents>
+        {
+        public:
+            constexpr mapping(const TExtents& extents)
+                : details::strided_mapping<TExtents>{extents, strides_for(extents)}
+            {
+            }
+
+        private:
+            static constexpr auto strides_for(const TExtents& extents)
+            {
+                std::array<size_t, TExtents::rank()> strides{};
+                size_t stride = 1;
+                for (size_t r = 0; r < TExtents::rank(); ++r)
+                {
+                    strides[r] = stride;
+                    stride *= extents.extent(r);
+                }
+                return strides;
+            }
+        };
+    };
+
+    // arbitrary strides - result of slicing, padded rows, every n-th element
+    struct layout_stride
+    {
+        template <typename TExtents>
+        using mapping = details::strided_mapping<TExtents>;
+    };
+
+    template <typename T, typename TExtents, typename TLayout = layout_right>
+    class mdspan
+    {
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using extents_type = TExtents;
+        using layout_type = TLayout;
+        using mapping_type = typename TLayout::template mapping<TExtents>;
+
+        template <std::convertible_to<size_t>... TExtents_>
+            requires(sizeof...(TExtents_) == TExtents::rank() && std::constructible_from<mapping_type, TExtents>)
+        constexpr mdspan(T* data, TExtents_... extents)
+            : data_{data}
+            , mapping_{TExtents{extents...}}
+        {
+        }
+
+        constexpr mdspan(T* data, const mapping_type& mapping)
+            : data_{data}
+            , mapping_{mapping}
+        {
+        }
+
+        // mdspan<int, ...> -> mdspan<const int, ...>
+        template <typename U>
+            requires std::convertible_to<U (*)[], T (*)[]>
+        constexpr mdspan(const mdspan<U, TExtents, TLayout>& other)
+            : data_{other.data_handle()}
+            , mapping_{other.mapping()}
+        {
+        }
+
+        template <std::convertible_to<size_t>... TIndexes>
+            requires(sizeof...(TIndexes) == TExtents::rank())
+        constexpr T& operator()(TIndexes... indexes) const
+        {
+            assert(in_bounds({static_cast<size_t>(indexes)...}));
+            return data_[mapping_(indexes...)];
+        }
+
+        static constexpr size_t rank()
+        {
+            return TExtents::rank();
+        }
+
+        constexpr size_t extent(size_t r) const
+        {
+            return mapping_.extents().extent(r);
+        }
+
+        constexpr size_t stride(size_t r) const
+        {
+            return mapping_.stride(r);
+        }
+
+        constexpr size_t size() const
+        {
+            return mapping_.extents().size();
+        }
+
+        constexpr bool empty() const
+        {
+            return size() == 0;
+        }
+
+        constexpr const extents_type& extents() const
+        {
+            return mapping_.extents();
+        }
+
+        constexpr const mapping_type& mapping() const
+        {
+            return mapping_;
+        }
+
+        constexpr T* data_handle() const
+        {
+            return data_;
+        }
+
+        constexpr bool is_exhaustive() const
+        {
+            return mapping_.is_exhaustive();
+        }
+
+    private:
+        T* data_;
+        mapping_type mapping_;
+
+        constexpr bool in_bounds(const std::array<size_t, TExtents::rank()>& indexes) const
+        {
+            for (size_t r = 0; r < rank(); ++r)
+                if (indexes[r] >= extent(r))
+                    return false;
+            return true;
+        }
+    };
+
+    template <typename T, std::convertible_to<size_t>... TExtents>
+    mdspan(T*, TExtents...) -> mdspan<T, dextents<sizeof...(TExtents)>>;
+
+    ///////////////////////////////////////////////////////////////
+    // submdspan
+
+    struct full_extent_t
+    {
+        explicit full_extent_t() = default;
+    };
+
+    inline constexpr full_extent_t full_extent{};
+
+    // [first, last) range of a dimension - std::pair or std::tuple work as well
+    struct slice
+    {
+        size_t first;
+        size_t last;
+    };
+
+    template <typename TSlice>
+    concept IndexSlice = std::convertible_to<TSlice, size_t> && !std::same_as<TSlice, full_extent_t>;
+
+    template <typename TSlice>
+    concept RangeSlice = std::same_as<TSlice, full_extent_t> || std::convertible_to<TSlice, slice>
+        || requires(TSlice s) { std::get<0>(s); std::get<1>(s); };
+
+    // an index removes the dimension, full_extent or a [first, last) range keeps it
+    template <typename T, typename TExtents, typename TLayout, typename... TSlices>
+        requires(sizeof...(TSlices) == TExtents::rank() && ((IndexSlice<TSlices> || RangeSlice<TSlices>) && ...))
+    constexpr auto submdspan(const mdspan<T, TExtents, TLayout>& source, TSlices... slices)
+    {
+        constexpr size_t sub_rank = ((IndexSlice<TSlices> ? 0 : 1) + ... + 0);
+
+        std::array<size_t, sub_rank> extents{};
+        std::array<size_t, sub_rank> strides{};
+        size_t offset = 0;
+        size_t source_dim = 0;
+        size_t sub_dim = 0;
+
+        auto apply = [&]<typename TSlice>(const TSlice& s) {
+            if constexpr (IndexSlice<TSlice>)
+            {
+                assert(static_cast<size_t>(s) < source.extent(source_dim));
+                offset += static_cast<size_t>(s) * source.stride(source_dim);
+            }
+            else
+            {
+                size_t first = 0;
+                size_t last = source.extent(source_dim);
+                if constexpr (std::convertible_to<TSlice, slice>)
+                {
+                    const slice range = s;
+                    first = range.first;
+                    last = range.last;
+                }
+                else if constexpr (!std::same_as<TSlice, full_extent_t>)
+                {
+                    first = std::get<0>(s);
+                    last = std::get<1>(s);
+                }
+
+                assert(first <= last && last <= source.extent(source_dim));
+                offset += first * source.stride(source_dim);
+                extents[sub_dim] = last - first;
+                strides[sub_dim] = source.stride(source_dim);
+                ++sub_dim;
+            }
+            ++source_dim;
+        };
+        (apply(slices), ...);
+
+        using sub_extents = dextents<sub_rank>;
+        return mdspan<T, sub_extents, layout_stride>{source.data_handle() + offset, layout_stride::mapping<sub_extents>{sub_extents{extents}, strides}};
+    }
+
+    // contiguous row of a row-major matrix - drop-in for span.subspan(row * col_size, col_size)
+    template <typename T>
+    constexpr std::span<T> row(const mdspan<T, dextents<2>, layout_right>& matrix, size_t r)
+    {
+        assert(r < matrix.extent(0));
+        return {matrix.data_handle() + r * matrix.stride(0), matrix.extent(1)};
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // cache-blocked algorithms for matrices (rank 2, any layout)
+
+    template <typename TMdspan>
+    concept Matrix = requires(const TMdspan& m) {
+        typename TMdspan::element_type;
+        requires TMdspan::rank() == 2;
+        m.extent(0);
+        m.stride(0);
+    };
+
+    // f(tile) for every tile_rows x tile_cols block (tiles at the edges are smaller) - row of tiles after row of tiles
+    template <Matrix TMatrix, typename TFunction>
+    void for_each_tile(const TMatrix& m, size_t tile_rows, size_t tile_cols, TFunction f)
+    {
+        assert(tile_rows > 0 && tile_cols > 0);
+
+        for (size_t r = 0; r < m.extent(0); r += tile_rows)
+            for (size_t c = 0; c < m.extent(1); c += tile_cols)
+                f(submdspan(m, slice{r, std::min(r + tile_rows, m.extent(0))}, slice{c, std::min(c + tile_cols, m.extent(1))}));
+    }
+
+    template <Matrix TSource, Matrix TDestination>
+    void transpose(const TSource& source, const TDestination& destination)
+    {
+        assert(destination.extent(0) == source.extent(1) && destination.extent(1) == source.extent(0));
+
+        for (size_t i = 0; i < source.extent(0); ++i)
+            for (size_t j = 0; j < source.extent(1); ++j)
+                destination(j, i) = source(i, j);
+    }
+
+    // 32 x 32 tiles: rows of both tiles touch at most 64 pages - they stay within a typical L1 DTLB,
+    // and 2 x 32 x 32 x sizeof(float) fits comfortably in L1
+    inline constexpr size_t default_transpose_tile = 32;
+
+    template <Matrix TSource, Matrix TDestination>
+    void transpose_blocked(const TSource& source, const TDestination& destination, size_t tile = default_transpose_tile)
+    {
+        assert(destination.extent(0) == source.extent(1) && destination.extent(1) == source.extent(0));
+        assert(tile > 0);
+
+        const size_t rows = source.extent(0);
+        const size_t cols = source.extent(1);
+
+        for (size_t ii = 0; ii < rows; ii += tile)
+            for (size_t jj = 0; jj < cols; jj += tile)
+            {
+                const size_t i_end = std::min(ii + tile, rows);
+                const size_t j_end = std::min(jj + tile, cols);
+
+                for (size_t i = ii; i < i_end; ++i)
+                    for (size_t j = jj; j < j_end; ++j)
+                        destination(j, i) = source(i, j);
+            }
+    }
+
+    // out[i] = sum of row i; the matrix is always walked in memory order
+    template <Matrix TMatrix, typename TOut>
+    void sum_rows(const TMatrix& m, std::span<TOut> out)
+    {
+        assert(out.size() >= m.extent(0));
+        std::fill_n(out.begin(), m.extent(0), TOut{});
+
+        if (m.stride(1) <= m.stride(0))
+        {
+            for (size_t i = 0; i < m.extent(0); ++i)
+            {
+                TOut sum{};
+                for (size_t j = 0; j < m.extent(1); ++j)
+                    sum += m(i, j);
+                out[i] = sum;
+            }
+        }
+        else
+        {
+            for (size_t j = 0; j < m.extent(1); ++j)
+                for (size_t i = 0; i < m.extent(0); ++i)
+                    out[i] += m(i, j);
+        }
+    }
+
+    // out[j] = sum of column j; the matrix is always walked in memory order
+    template <Matrix TMatrix, typename TOut>
+    void sum_cols(const TMatrix& m, std::span<TOut> out)
+    {
+        assert(out.size() >= m.extent(1));
+        std::fill_n(out.begin(), m.extent(1), TOut{});
+
+        if (m.stride(1) <= m.stride(0))
+        {
+            for (size_t i = 0; i < m.extent(0); ++i)
+                for (size_t j = 0; j < m.extent(1); ++j)
+                    out[j] += m(i, j);
+        }
+        else
+        {
+            for (size_t j = 0; j < m.extent(1); ++j)
+            {
+                TOut sum{};
+                for (size_t i = 0; i < m.extent(0); ++i)
+                    sum += m(i, j);
+                out[j] = sum;
+            }
+        }
+    }
+} // namespace md
+
+#endif
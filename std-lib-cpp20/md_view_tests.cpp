@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "md_view.hpp"
+
+TEST_CASE("md::mdspan - layouts")
+{
+    std::vector<int> vec(12);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    SECTION("layout_right - row-major")
+    {
+        md::mdspan matrix{vec.data(), 3, 4};
+
+        static_assert(decltype(matrix)::rank() == 2);
+        CHECK(matrix.extent(0) == 3);
+        CHECK(matrix.extent(1) == 4);
+        CHECK(matrix.stride(0) == 4);
+        CHECK(matrix.stride(1) == 1);
+        CHECK(matrix(1, 2) == 6);
+        CHECK(matrix(2, 3) == 11);
+        CHECK(matrix.is_exhaustive());
+    }
+
+    SECTION("layout_left - column-major")
+    {
+        md::mdspan<int, md::dextents<2>, md::layout_left> matrix{vec.data(), 3, 4};
+
+        CHECK(matrix.stride(0) == 1);
+        CHECK(matrix.stride(1) == 3);
+        CHECK(matrix(1, 2) == 7);
+        CHECK(matrix(2, 3) == 11);
+    }
+
+    SECTION("layout_stride - every second column")
+    {
+        using Extents = md::dextents<2>;
+        md::mdspan<int, Extents, md::layout_stride> matrix{vec.data(), md::layout_stride::mapping<Extents>{Extents{3, 2}, {4, 2}}};
+
+        CHECK(matrix(0, 1) == 2);
+        CHECK(matrix(2, 1) == 10);
+        CHECK_FALSE(matrix.is_exhaustive());
+    }
+
+    SECTION("3D")
+    {
+        md::mdspan cube{vec.data(), 2, 3, 2};
+
+        CHECK(cube(1, 2, 1) == 11);
+        CHECK(cube(1, 0, 1) == 7);
+
+        md::mdspan<int, md::dextents<3>, md::layout_left> cube_left{vec.data(), 2, 3, 2};
+        CHECK(cube_left(1, 2, 1) == 1 + 2 * 2 + 1 * 6);
+    }
+
+    SECTION("writable & const views")
+    {
+        md::mdspan matrix{vec.data(), 3, 4};
+        matrix(0, 0) = 42;
+
+        md::mdspan<const int, md::dextents<2>> const_matrix = matrix;
+        CHECK(const_matrix(0, 0) == 42);
+    }
+}
+
+TEST_CASE("md::submdspan")
+{
+    std::vector<int> vec(24);
+    std::iota(vec.begin(), vec.end(), 0);
+    md::mdspan cube{vec.data(), 2, 3, 4};
+
+    SECTION("index removes a dimension")
+    {
+        auto plane = md::submdspan(cube, 1, md::full_extent, md::full_extent);
+
+        static_assert(decltype(plane)::rank() == 2);
+        CHECK(plane.extent(0) == 3);
+        CHECK(plane.extent(1) == 4);
+        CHECK(plane(2, 3) == 23);
+    }
+
+    SECTION("ranges keep a dimension")
+    {
+        auto block = md::submdspan(cube, md::full_extent, md::slice{1, 3}, std::pair{2, 4});
+
+        static_assert(decltype(block)::rank() == 3);
+        CHECK(block.extent(1) == 2);
+        CHECK(block.extent(2) == 2);
+        CHECK(block(0, 0, 0) == 6);
+        CHECK(block(1, 1, 1) == 12 + 8 + 3);
+    }
+
+    SECTION("column of a matrix")
+    {
+        md::mdspan matrix{vec.data(), 6, 4};
+        auto column = md::submdspan(matrix, md::full_extent, 1);
+
+        static_assert(decltype(column)::rank() == 1);
+        CHECK(column.extent(0) == 6);
+        CHECK(column.stride(0) == 4);
+        CHECK(column(5) == 21);
+    }
+
+    SECTION("rows as spans")
+    {
+        md::mdspan matrix{vec.data(), 6, 4};
+
+        CHECK(md::row(matrix, 2).size() == 4);
+        CHECK(md::row(matrix, 2)[0] == 8);
+    }
+}
+
+TEST_CASE("md - cache-blocked algorithms")
+{
+    const size_t rows = 37;
+    const size_t cols = 53;
+
+    std::vector<int> data(rows * cols);
+    std::iota(data.begin(), data.end(), 0);
+    md::mdspan matrix{data.data(), rows, cols};
+
+    SECTION("tiles cover the whole matrix exactly once")
+    {
+        std::vector<int> visits(data.size());
+        md::mdspan visited{visits.data(), rows, cols};
+
+        md::for_each_tile(md::submdspan(visited, md::full_extent, md::full_extent), 8, 16, [](auto tile) {
+            for (size_t i = 0; i < tile.extent(0); ++i)
+                for (size_t j = 0; j < tile.extent(1); ++j)
+                    ++tile(i, j);
+        });
+
+        CHECK(std::ranges::all_of(visits, [](int v) { return v == 1; }));
+    }
+
+    SECTION("blocked transpose")
+    {
+        std::vector<int> expected(data.size());
+        std::vector<int> transposed(data.size());
+
+        md::transpose(matrix, md::mdspan{expected.data(), cols, rows});
+        md::transpose_blocked(matrix, md::mdspan{transposed.data(), cols, rows}, 8);
+
+        CHECK(transposed == expected);
+        CHECK(md::mdspan{transposed.data(), cols, rows}(4, 7) == matrix(7, 4));
+    }
+
+    SECTION("transpose into layout_left is a copy")
+    {
+        std::vector<int> transposed(data.size());
+        md::transpose_blocked(matrix, md::mdspan<int, md::dextents<2>, md::layout_left>{transposed.data(), cols, rows});
+
+        CHECK(transposed == data);
+    }
+
+    SECTION("row & column reductions")
+    {
+        std::vector<long> row_sums(rows);
+        std::vector<long> col_sums(cols);
+        md::sum_rows(matrix, std::span{row_sums});
+        md::sum_cols(matrix, std::span{col_sums});
+
+        for (size_t i = 0; i < rows; ++i)
+            CHECK(row_sums[i] == std::accumulate(data.begin() + i * cols, data.begin() + (i + 1) * cols, 0L));
+
+        long col_0 = 0;
+        for (size_t i = 0; i < rows; ++i)
+            col_0 += matrix(i, 0);
+        CHECK(col_sums[0] == col_0);
+        CHECK(std::accumulate(col_sums.begin(), col_sums.end(), 0L) == std::accumulate(data.begin(), data.end(), 0L));
+
+        std::vector<long> left_col_sums(rows);
+        md::sum_cols(md::mdspan<int, md::dextents<2>, md::layout_left>{data.data(), cols, rows}, std::span{left_col_sums});
+        CHECK(left_col_sums == row_sums);
+    }
+}
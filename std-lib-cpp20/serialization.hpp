@@ -0,0 +1,419 @@
+#ifndef SERIALIZATION_HPP
+#define SERIALIZATION_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sys/uio.h>) && __has_include(<unistd.h>)
+#define SERIALIZATION_HAS_WRITEV 1
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Binary messages built from std::as_bytes - every field is a span of trivially copyable items
+// written with one memcpy (or gathered by writev) and read back without copying:
+//
+//   Header | FieldEntry[field_count] | padding | field 0 | padding | field 1 | ...
+//
+// Fields start at offsets aligned to field_alignment, so a reader over a suitably aligned buffer
+// (mmap, aligned allocation) can return std::span<const T> pointing straight into it.
+// Variable-length fields are stored as two entries: an offset table (count + 1 uint64 values) and the concatenated items.
+namespace serialization
+{
+    inline constexpr size_t field_alignment = 64;
+
+    template <typename T>
+    concept Serializable = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && alignof(T) <= field_alignment;
+
+    enum class FieldKind : std::uint32_t
+    {
+        array,
+        jagged_offsets, // followed by an array entry with the items
+    };
+
+    struct Header
+    {
+        static constexpr std::uint32_t expected_magic = 0x31425053; // "SPB1"
+        static constexpr std::uint16_t current_version = 1;
+
+        std::uint32_t magic = expected_magic;
+        std::uint16_t byte_order_mark = 0xFEFF; // reads as 0xFFFE on a machine with different endianness
+        std::uint16_t version = current_version;
+        std::uint32_t field_count = 0;
+        std::uint32_t reserved = 0;
+        std::uint64_t total_size = 0;
+    };
+
+    struct FieldEntry
+    {
+        std::uint64_t offset;
+        std::uint64_t size_bytes;
+        std::uint32_t item_size;
+        FieldKind kind;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 24);
+    static_assert(std::is_trivially_copyable_v<FieldEntry> && sizeof(FieldEntry) == 24);
+
+    constexpr size_t align_up(size_t offset, size_t alignment = field_alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    class Writer
+    {
+    public:
+        Writer() = default;
+
+        // fields of jagged items point into owned_offsets_ - a copy would point into the original
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+        Writer(Writer&&) noexcept = default; // deque elements keep their addresses
+        Writer& operator=(Writer&&) noexcept = default;
+
+        // the writer keeps spans only - data must outlive the writer; returns index of the field
+        template <Serializable T>
+        size_t add(std::span<const T> items)
+        {
+            add_entry(FieldKind::array, sizeof(T), {{std::as_bytes(items)}});
+            return fields_.size() - 1;
+        }
+
+        template <Serializable T>
+        size_t add(std::span<T> items)
+        {
+            return add(std::span<const T>{items});
+        }
+
+        // variable-length items - rows of different length, strings; read back with Reader::jagged<T>() or Reader::strings()
+        template <std::ranges::input_range TRows>
+            requires std::ranges::contiguous_range<std::ranges::range_reference_t<TRows>>
+            && Serializable<std::ranges::range_value_t<std::ranges::range_reference_t<TRows>>>
+        size_t add_jagged(const TRows& rows)
+        {
+            using T = std::ranges::range_value_t<std::ranges::range_reference_t<TRows>>;
+
+            auto& offsets = owned_offsets_.emplace_back(1, 0);
+            std::vector<std::span<const std::byte>> chunks;
+            for (const auto& row : rows)
+            {
+                const std::span<const T> items{std::ranges::data(row), std::ranges::size(row)};
+                offsets.push_back(offsets.back() + items.size());
+                chunks.push_back(std::as_bytes(items));
+            }
+
+            add_entry(FieldKind::jagged_offsets, sizeof(std::uint64_t), {{std::as_bytes(std::span{offsets})}});
+            add_entry(FieldKind::array, sizeof(T), std::move(chunks));
+            return fields_.size() - 2;
+        }
+
+        size_t field_count() const
+        {
+            return fields_.size();
+        }
+
+        // size of the whole message
+        size_t size() const
+        {
+            return fields_.empty() ? prefix_size() : fields_.back().entry.offset + fields_.back().entry.size_bytes;
+        }
+
+        // buffer.size() must be at least size(); returns number of written bytes
+        size_t write_to(std::span<std::byte> buffer) const
+        {
+            const size_t total_size = size();
+            if (buffer.size() < total_size)
+                throw std::length_error("buffer too small for the message");
+
+            write_prefix(buffer.first(prefix_size()));
+            size_t position = prefix_size();
+
+            for (const auto& field : fields_)
+            {
+                std::memset(buffer.data() + position, 0, field.entry.offset - position); // padding
+                position = field.entry.offset;
+
+                for (const auto& chunk : field.chunks)
+                {
+                    if (!chunk.empty())
+                        std::memcpy(buffer.data() + position, chunk.data(), chunk.size());
+                    position += chunk.size();
+                }
+            }
+
+            return total_size;
+        }
+
+        std::vector<std::byte> serialize() const
+        {
+            std::vector<std::byte> buffer(size());
+            write_to(buffer);
+            return buffer;
+        }
+
+        // portable fallback for write_to_fd - one fwrite per part, items are copied only into the FILE buffer
+        void write_to_file(std::FILE* file) const
+        {
+            std::vector<std::byte> prefix(prefix_size());
+            for (auto part : gather(prefix))
+                if (std::fwrite(part.data(), 1, part.size(), file) != part.size())
+                    throw std::system_error(errno, std::generic_category(), "fwrite");
+        }
+
+#ifdef SERIALIZATION_HAS_WRITEV
+        // gathers header and fields with writev - items are never copied in user space
+        void write_to_fd(int fd) const
+        {
+            std::vector<std::byte> prefix(prefix_size());
+
+            std::vector<iovec> parts;
+            for (auto part : gather(prefix))
+                parts.push_back(iovec{const_cast<std::byte*>(part.data()), part.size()});
+
+            write_all(fd, parts);
+        }
+#endif
+
+    private:
+        struct Field
+        {
+            FieldEntry entry;
+            std::vector<std::span<const std::byte>> chunks;
+        };
+
+        std::vector<Field> fields_;
+        std::deque<std::vector<std::uint64_t>> owned_offsets_; // deque - references stay valid
+
+        size_t prefix_size() const
+        {
+            return sizeof(Header) + fields_.size() * sizeof(FieldEntry);
+        }
+
+        void add_entry(FieldKind kind, size_t item_size, std::vector<std::span<const std::byte>> chunks)
+        {
+            size_t size_bytes = 0;
+            for (const auto& chunk : chunks)
+                size_bytes += chunk.size();
+
+            fields_.push_back(Field{FieldEntry{0, size_bytes, static_cast<std::uint32_t>(item_size), kind}, std::move(chunks)});
+
+            // the table grows with every field - offsets of all fields move
+            size_t offset = align_up(prefix_size());
+            for (auto& field : fields_)
+            {
+                field.entry.offset = offset;
+                offset = align_up(offset + field.entry.size_bytes);
+            }
+        }
+
+        // prefix (written into the buffer), padding and item chunks in message order
+        std::vector<std::span<const std::byte>> gather(std::span<std::byte> prefix) const
+        {
+            static constexpr std::byte padding[field_alignment] = {};
+
+            write_prefix(prefix);
+
+            std::vector<std::span<const std::byte>> parts;
+            size_t position = prefix_size();
+            parts.push_back(prefix);
+
+            for (const auto& field : fields_)
+            {
+                if (field.entry.offset > position)
+                    parts.push_back(std::span{padding}.first(field.entry.offset - position));
+                position = field.entry.offset;
+
+                for (const auto& chunk : field.chunks)
+                {
+                    if (!chunk.empty())
+                        parts.push_back(chunk);
+                    position += chunk.size();
+                }
+            }
+
+            return parts;
+        }
+
+        void write_prefix(std::span<std::byte> out) const
+        {
+            Header header;
+            header.field_count = static_cast<std::uint32_t>(fields_.size());
+            header.total_size = size();
+            std::memcpy(out.data(), &header, sizeof(header));
+
+            for (size_t i = 0; i < fields_.size(); ++i)
+                std::memcpy(out.data() + sizeof(Header) + i * sizeof(FieldEntry), &fields_[i].entry, sizeof(FieldEntry));
+        }
+
+#ifdef SERIALIZATION_HAS_WRITEV
+        static void write_all(int fd, std::span<iovec> parts)
+        {
+            while (!parts.empty())
+            {
+                const auto count = static_cast<int>(std::min<size_t>(parts.size(), IOV_MAX));
+                const ssize_t written = ::writev(fd, parts.data(), count);
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::system_error(errno, std::generic_category(), "writev");
+                }
+
+                // skip fully written parts, adjust a partially written one
+                auto remaining = static_cast<size_t>(written);
+                while (!parts.empty() && remaining >= parts.front().iov_len)
+                {
+                    remaining -= parts.front().iov_len;
+                    parts = parts.subspan(1);
+                }
+                if (remaining > 0)
+                {
+                    parts.front().iov_base = static_cast<std::byte*>(parts.front().iov_base) + remaining;
+                    parts.front().iov_len -= remaining;
+                }
+            }
+        }
+#endif
+    };
+
+    // variable-length field - rows are spans into the message
+    template <typename T>
+    class JaggedView
+    {
+    public:
+        JaggedView(std::span<const std::uint64_t> offsets, std::span<const T> items)
+            : offsets_{offsets}
+            , items_{items}
+        {
+        }
+
+        size_t size() const
+        {
+            return offsets_.size() - 1;
+        }
+
+        std::span<const T> operator[](size_t index) const
+        {
+            return items_.subspan(offsets_[index], offsets_[index + 1] - offsets_[index]);
+        }
+
+        std::span<const T> items() const
+        {
+            return items_;
+        }
+
+    private:
+        std::span<const std::uint64_t> offsets_;
+        std::span<const T> items_;
+    };
+
+    // validates the message once in the constructor - field access is a few comparisons and a cast
+    class Reader
+    {
+    public:
+        explicit Reader(std::span<const std::byte> buffer)
+            : buffer_{buffer}
+        {
+            if (buffer.size() < sizeof(Header))
+                throw std::invalid_argument("buffer too small for a message header");
+
+            std::memcpy(&header_, buffer.data(), sizeof(Header));
+
+            if (header_.magic != Header::expected_magic)
+                throw std::invalid_argument("not a serialized message");
+            if (header_.byte_order_mark != 0xFEFF)
+                throw std::invalid_argument("message was written on a machine with different byte order");
+            if (header_.version != Header::current_version)
+                throw std::invalid_argument("unsupported message version");
+            if (header_.total_size > buffer.size())
+                throw std::invalid_argument("truncated message");
+            if (sizeof(Header) + std::uint64_t{header_.field_count} * sizeof(FieldEntry) > header_.total_size)
+                throw std::invalid_argument("field table out of bounds");
+
+            entries_.resize(header_.field_count);
+            if (!entries_.empty())
+                std::memcpy(entries_.data(), buffer.data() + sizeof(Header), entries_.size() * sizeof(FieldEntry));
+
+            for (const auto& entry : entries_)
+            {
+                if (entry.offset > header_.total_size || entry.size_bytes > header_.total_size - entry.offset)
+                    throw std::invalid_argument("field out of bounds");
+                if (entry.item_size == 0 || entry.size_bytes % entry.item_size != 0)
+                    throw std::invalid_argument("field size is not a multiple of its item size");
+            }
+        }
+
+        size_t field_count() const
+        {
+            return entries_.size();
+        }
+
+        const FieldEntry& entry(size_t index) const
+        {
+            return entries_.at(index);
+        }
+
+        // zero-copy - span into the buffer; throws if T does not match the field or the buffer is misaligned for T
+        template <Serializable T>
+        std::span<const T> field(size_t index) const
+        {
+            const FieldEntry& e = entry(index);
+            if (e.item_size != sizeof(T))
+                throw std::invalid_argument("item size of the field does not match the requested type");
+
+            const std::byte* first = buffer_.data() + e.offset;
+            if (reinterpret_cast<std::uintptr_t>(first) % alignof(T) != 0)
+                throw std::invalid_argument("field is misaligned for the requested type - use an aligned buffer");
+
+            return {reinterpret_cast<const T*>(first), e.size_bytes / sizeof(T)};
+        }
+
+        template <Serializable T>
+        JaggedView<T> jagged(size_t index) const
+        {
+            if (entry(index).kind != FieldKind::jagged_offsets || index + 1 >= entries_.size())
+                throw std::invalid_argument("not a variable-length field");
+
+            const auto offsets = field<std::uint64_t>(index);
+            const auto items = field<T>(index + 1);
+
+            if (offsets.empty() || offsets.front() != 0 || !std::ranges::is_sorted(offsets) || offsets.back() != items.size())
+                throw std::invalid_argument("corrupted offset table");
+
+            return {offsets, items};
+        }
+
+        std::vector<std::string_view> strings(size_t index) const
+        {
+            const auto rows = jagged<char>(index);
+
+            std::vector<std::string_view> result;
+            result.reserve(rows.size());
+            for (size_t i = 0; i < rows.size(); ++i)
+                result.emplace_back(rows[i].data(), rows[i].size());
+            return result;
+        }
+
+    private:
+        std::span<const std::byte> buffer_;
+        Header header_;
+        std::vector<FieldEntry> entries_;
+    };
+} // namespace serialization
+
+#endif
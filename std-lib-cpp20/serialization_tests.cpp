@@ -0,0 +1,178 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "serialization.hpp"
+
+namespace
+{
+    struct Point
+    {
+        float x, y, z;
+
+        bool operator==(const Point&) const = default;
+    };
+} // namespace
+
+TEST_CASE("serialization - arrays of trivially copyable items")
+{
+    std::vector<float> samples(1000);
+    std::iota(samples.begin(), samples.end(), std::numbers::pi_v<float>);
+    const std::vector<Point> points = {{1, 2, 3}, {4, 5, 6}};
+    const std::vector<double> empty;
+
+    serialization::Writer writer;
+    CHECK(writer.add(std::span{samples}) == 0);
+    CHECK(writer.add(std::span{points}) == 1);
+    CHECK(writer.add(std::span{empty}) == 2);
+
+    const auto message = writer.serialize();
+    CHECK(message.size() == writer.size());
+
+    serialization::Reader reader{message};
+    REQUIRE(reader.field_count() == 3);
+
+    SECTION("fields are spans into the buffer")
+    {
+        auto read_samples = reader.field<float>(0);
+
+        CHECK(std::ranges::equal(read_samples, samples));
+        CHECK(static_cast<const void*>(read_samples.data()) == static_cast<const void*>(message.data() + reader.entry(0).offset));
+        CHECK(reader.entry(0).offset % serialization::field_alignment == 0);
+        CHECK(reader.entry(1).offset % serialization::field_alignment == 0);
+
+        CHECK(std::ranges::equal(reader.field<Point>(1), points));
+        CHECK(reader.field<double>(2).empty());
+    }
+
+    SECTION("item size is checked")
+    {
+        CHECK_THROWS_AS(reader.field<double>(0), std::invalid_argument);
+        CHECK_THROWS_AS(reader.field<float>(3), std::out_of_range);
+    }
+
+    SECTION("alignment is checked")
+    {
+        std::vector<std::byte> shifted(message.size() + 1);
+        std::ranges::copy(message, shifted.begin() + 1);
+
+        serialization::Reader misaligned{std::span{shifted}.subspan(1)};
+
+        CHECK_THROWS_AS(misaligned.field<float>(0), std::invalid_argument);
+    }
+
+    SECTION("byte order is checked")
+    {
+        auto swapped = message;
+        std::swap(swapped[4], swapped[5]); // byte_order_mark
+
+        CHECK_THROWS_AS(serialization::Reader{swapped}, std::invalid_argument);
+    }
+
+    SECTION("truncated or foreign buffers are rejected")
+    {
+        CHECK_THROWS_AS(serialization::Reader{std::span{message}.first(message.size() - 1)}, std::invalid_argument);
+        CHECK_THROWS_AS(serialization::Reader{std::span{message}.first(10)}, std::invalid_argument);
+
+        auto foreign = message;
+        foreign[0] = std::byte{'X'};
+        CHECK_THROWS_AS(serialization::Reader{foreign}, std::invalid_argument);
+    }
+
+    SECTION("caller buffer")
+    {
+        std::vector<std::byte> buffer(writer.size());
+        CHECK(writer.write_to(buffer) == message.size());
+        CHECK(buffer == message);
+
+        std::vector<std::byte> too_small(writer.size() - 1);
+        CHECK_THROWS_AS(writer.write_to(too_small), std::length_error);
+    }
+}
+
+TEST_CASE("serialization - variable-length fields")
+{
+    const std::vector<std::vector<int>> rows = {{1, 2, 3}, {}, {4}, {5, 6}};
+    const std::vector<std::string> words = {"one", "", "three", "a rather long string - no small string optimization"};
+
+    serialization::Writer writer;
+    const size_t rows_field = writer.add_jagged(rows);
+    const size_t words_field = writer.add_jagged(words);
+
+    const auto message = writer.serialize();
+    serialization::Reader reader{message};
+
+    auto read_rows = reader.jagged<int>(rows_field);
+    REQUIRE(read_rows.size() == rows.size());
+    for (size_t i = 0; i < rows.size(); ++i)
+        CHECK(std::ranges::equal(read_rows[i], rows[i]));
+
+    auto read_words = reader.strings(words_field);
+    CHECK(std::ranges::equal(read_words, words));
+
+    CHECK_THROWS_AS(reader.jagged<int>(rows_field + 1), std::invalid_argument);
+}
+
+#ifdef SERIALIZATION_HAS_WRITEV
+TEST_CASE("serialization - writev to a file descriptor")
+{
+    std::vector<double> values(10'000);
+    std::iota(values.begin(), values.end(), 0.5);
+    const std::vector<std::string> names = {"x", "y"};
+
+    serialization::Writer writer;
+    writer.add(std::span{values});
+    writer.add_jagged(names);
+
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    writer.write_to_fd(fileno(file));
+
+    std::vector<std::byte> written(writer.size());
+    std::rewind(file);
+    CHECK(std::fread(written.data(), 1, written.size(), file) == written.size());
+    std::fclose(file);
+
+    CHECK(written == writer.serialize());
+}
+#endif
+
+TEST_CASE("serialization - fwrite to a FILE")
+{
+    static_assert(!std::is_copy_constructible_v<serialization::Writer>); // jagged fields point into the writer
+    static_assert(std::is_nothrow_move_constructible_v<serialization::Writer>);
+
+    std::vector<double> values(10'000);
+    std::iota(values.begin(), values.end(), 0.5);
+    const std::vector<std::string> names = {"x", "y"};
+
+    serialization::Writer writer;
+    writer.add(std::span{values});
+    writer.add_jagged(names);
+    serialization::Writer moved = std::move(writer);
+
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    moved.write_to_file(file);
+
+    std::vector<std::byte> written(moved.size());
+    std::rewind(file);
+    CHECK(std::fread(written.data(), 1, written.size(), file) == written.size());
+    std::fclose(file);
+
+    CHECK(written == moved.serialize());
+
+    serialization::Reader reader{written};
+    auto read_names = reader.strings(1);
+    CHECK(std::ranges::equal(read_names, names));
+}
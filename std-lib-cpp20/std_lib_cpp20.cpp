@@ -1,27 +1,38 @@
 #include <catch2/catch_test_macros.hpp>
+#include <compiled_format.hpp>
+#include <cstdio>
+#include <fill.hpp>
+#include <hex.hpp>
 #include <iostream>
 #include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <format>
 #include <numbers>
 #include <numeric>
 
+#include "md_view.hpp"
+
 using namespace std::literals;
 
 void print(std::span<const int> data)
 {
+    // items are formatted straight into one buffer and the line is written once
+    constexpr size_t max_item_size = 12; // "-2147483648 "
+    std::string line(data.size() * max_item_size + 1, '\0');
+
+    size_t size = 0;
     for (const auto& item : data)
-        std::cout << item << " ";
-    std::cout << "\n";
+        size += helpers::fmt_string<"{} ">::format_to(std::span{line}.subspan(size), item);
+    line[size++] = '\n';
+
+    std::fwrite(line.data(), 1, size, stdout);
 }
 
 void zero(std::span<int> data, int zero_value = 0)
 {
-    for (auto& item : data)
-    {
-        item = zero_value;
-    }
+    helpers::fill(data, zero_value); // memset, broadcast or streaming stores - see helpers/fill.hpp
 }
 
 TEST_CASE("std::span")
@@ -73,11 +84,13 @@ TEST_CASE("std::span - api")
 
 void print_as_bytes(const float f, const std::span<const std::byte> bytes)
 {
+    const std::string hex = helpers::hex::encode(bytes); // one pass over a 512-entry table - no string per byte
+
     std::cout << std::format("{:+6}", f) << " - { ";
-    
-    for(std::byte b : bytes)
+
+    for(size_t i = 0; i < hex.size(); i += 2)
     {
-        std::cout << std::format("{:02X} ", std::to_integer<int>(b));
+        std::cout << std::string_view{hex}.substr(i, 2) << " ";
     }
 
     std::cout << "}\n";
@@ -93,6 +106,8 @@ TEST_CASE("span of bytes")
     std::span<std::byte> writeable_bytes = std::as_writable_bytes(std::span{data});
     writeable_bytes[3] |= std::byte{0b1000'0000};
     print_as_bytes(data[0], const_bytes);
+
+    std::cout << helpers::hex::xxd(const_bytes); // 00000000: db0f 49c0    ..I.
 }
 
 TEST_CASE("subspans")
@@ -114,6 +129,20 @@ TEST_CASE("subspans")
     }
 }
 
+TEST_CASE("subspans - md::mdspan")
+{
+    std::vector<int> vec(100);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    md::mdspan matrix{vec.data(), 10, 10};
+
+    for(size_t row = 0; row < matrix.extent(0); ++row)
+        print(md::row(matrix, row));
+
+    auto column = md::submdspan(matrix, md::full_extent, 3);
+    CHECK(column(9) == 93);
+}
+
 std::span<int> get_head(std::span<int> items, size_t head_size = 1)
 {
     return items.first(head_size);
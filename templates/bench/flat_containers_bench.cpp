@@ -0,0 +1,80 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "flat_containers.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // 1024 lookups per iteration - half of the keys are present
+    void bench_lookups(helpers::benchmark::Runner& bench, size_t size)
+    {
+        helpers::random::PCG rnd{size};
+
+        std::vector<std::uint32_t> data(size);
+        std::ranges::generate(data, [&] { return static_cast<std::uint32_t>(rnd()) & ~1u; }); // even keys
+
+        std::vector<std::uint32_t> keys(1024);
+        for (size_t i = 0; i < keys.size(); ++i)
+            keys[i] = i % 2 == 0 ? data[rnd() % size] : static_cast<std::uint32_t>(rnd()) | 1u;
+
+        const std::set<std::uint32_t> tree(data.begin(), data.end());
+        const flat_set<std::uint32_t> flat{data};
+        const std::vector<std::uint32_t> sorted(flat.begin(), flat.end());
+
+        const std::string prefix = "N = " + std::to_string(size) + " - ";
+
+        bench.run(prefix + "std::set::contains", [&] {
+            size_t found = 0;
+            for (auto key : keys)
+                found += tree.contains(key);
+            do_not_optimize(found);
+        });
+
+        bench.run(prefix + "std::binary_search on sorted vector", [&] {
+            size_t found = 0;
+            for (auto key : keys)
+                found += std::binary_search(sorted.begin(), sorted.end(), key);
+            do_not_optimize(found);
+        });
+
+        bench.run(prefix + "flat_set::contains (branchless)", [&] {
+            size_t found = 0;
+            for (auto key : keys)
+                found += flat.contains(key);
+            do_not_optimize(found);
+        });
+    }
+} // namespace
+
+HELPERS_BENCHMARK("flat_set vs std::set - 1024 lookups of uint32_t")
+{
+    for (size_t size : {1'000, 10'000, 100'000, 1'000'000, 10'000'000})
+        bench_lookups(bench, size);
+}
+
+HELPERS_BENCHMARK("flat_set vs std::set - building from 1M random ints")
+{
+    helpers::random::PCG rnd{1'000'000};
+    std::vector<std::uint32_t> data(1'000'000);
+    std::ranges::generate(data, [&] { return static_cast<std::uint32_t>(rnd()); });
+
+    bench.run("std::set - insert one by one", [&] {
+        std::set<std::uint32_t> tree;
+        for (auto item : data)
+            tree.insert(item);
+        do_not_optimize(tree);
+    });
+
+    bench.run("flat_set - bulk insert (sort + unique)", [&] {
+        flat_set<std::uint32_t> flat{data};
+        do_not_optimize(flat);
+    });
+}
@@ -0,0 +1,127 @@
+#include <benchmark.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "logger.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // Logger<Str> before the background thread - formatting and a locked write on the caller's thread
+    template <Str LogPrefix>
+    struct SyncLogger
+    {
+        inline static std::mutex mtx;
+
+        void log(std::FILE* file, int id, double value, std::string_view name) const
+        {
+            const auto text = helpers::fmt_string<"id = {}, value = {}, name = {}">::format(id, value, name);
+
+            std::scoped_lock lk{mtx};
+            std::fputs(LogPrefix.value, file);
+            std::fwrite(text.data(), 1, text.size(), file);
+            std::fputc('\n', file);
+            std::fflush(file);
+        }
+    };
+
+    // single calls timed one by one - bursts shorter than the ring, so the caller never waits for the backend
+    template <typename TLog>
+    helpers::benchmark::Statistics call_latencies(TLog log_call)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr int bursts = 200;
+        constexpr int calls_per_burst = 500;
+
+        std::vector<double> samples;
+        samples.reserve(bursts * calls_per_burst);
+
+        for (int burst = 0; burst < bursts; ++burst)
+        {
+            logging::flush();
+            for (int i = 0; i < calls_per_burst; ++i)
+            {
+                const auto start = Clock::now();
+                log_call(i);
+                const auto stop = Clock::now();
+                samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+            }
+        }
+
+        return helpers::benchmark::Statistics::from(std::move(samples));
+    }
+
+    void report(std::string_view name, const helpers::benchmark::Statistics& stats)
+    {
+        std::cout << std::format("{:<48} {:>12.1f} ns  p99 {:>12.1f} ns  p99.9 {:>9.1f} ns  (per call)\n", name, stats.median, stats.p99, stats.p999);
+    }
+} // namespace
+
+template <>
+inline constexpr logging::Level logging::category_threshold<"[hot] "> = logging::Level::info;
+
+HELPERS_BENCHMARK("logger - trace statements in a hot loop, 4096 ints")
+{
+    std::vector<int> data(4096);
+    std::iota(data.begin(), data.end(), 0);
+
+    bench.run("no logging", [&] {
+        long long sum = 0;
+        for (int x : data)
+            sum += x;
+        do_not_optimize(sum);
+    });
+
+    Logger<"[hot] ", logging::Level::trace> compiled_out;
+    bench.run("trace - compiled out", [&] {
+        long long sum = 0;
+        for (int x : data)
+        {
+            LOGGER_LOG(compiled_out, "x = {}, sum = {}", x, sum);
+            sum += x;
+        }
+        do_not_optimize(sum);
+    });
+
+    Logger<"[loop] ", logging::Level::trace> runtime_disabled;
+    logging::set_level<"[loop] ">(logging::Level::info);
+    bench.run("trace - disabled at runtime", [&] {
+        long long sum = 0;
+        for (int x : data)
+        {
+            LOGGER_LOG(runtime_disabled, "x = {}, sum = {}", x, sum);
+            sum += x;
+        }
+        do_not_optimize(sum);
+    });
+}
+
+HELPERS_BENCHMARK("logger - call latency, output to /dev/null")
+{
+    std::FILE* null_file = std::fopen("/dev/null", "w");
+    logging::set_output(null_file);
+
+    const std::string name = "gadget";
+
+    SyncLogger<"[sync] "> sync_logger;
+    report("synchronous - format + locked fwrite", call_latencies([&](int i) { sync_logger.log(null_file, i, i * 0.5, name); }));
+
+    Logger<"[async] "> async_logger;
+    report("Logger - ring record, formatted in background",
+        call_latencies([&](int i) { async_logger.log<"id = {}, value = {}, name = {}">(i, i * 0.5, name); }));
+
+    bench.run("Logger - sustained (waits for the backend)", [&] { async_logger.log<"id = {}, value = {}, name = {}">(1, 0.5, name); });
+
+    logging::flush();
+    logging::set_output(std::cout);
+    std::fclose(null_file);
+}
@@ -0,0 +1,57 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "money.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr Tax vat_pl{0.23};
+
+    // calc_gross_price<Tax>(double) from templates.cpp + rounding to cents
+    template <Tax Vat>
+    double calc_gross_price_double(double net_price)
+    {
+        return std::round((net_price + net_price * Vat.value) * 100.0) / 100.0;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("money - gross prices, 1M catalog rows")
+{
+    constexpr size_t rows = 1'000'000;
+
+    helpers::random::PCG rnd{7};
+    std::vector<Money> net(rows);
+    std::vector<double> net_double(rows);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        net[i] = Money::from_units(static_cast<std::int64_t>(rnd() % 10'000'000));
+        net_double[i] = static_cast<double>(net[i].units) / 100.0;
+    }
+
+    std::vector<Money> gross(rows);
+    std::vector<double> gross_double(rows);
+
+    bench.run("double - calc_gross_price + std::round", [&] {
+        for (size_t i = 0; i < rows; ++i)
+            gross_double[i] = calc_gross_price_double<vat_pl>(net_double[i]);
+        do_not_optimize(gross_double);
+    });
+
+    bench.run("Money - calc_gross_price one by one (exact)", [&] {
+        for (size_t i = 0; i < rows; ++i)
+            gross[i] = calc_gross_price<vat_pl>(net[i]);
+        do_not_optimize(gross);
+    });
+
+    bench.run("Money - calc_gross_prices batch", [&] {
+        calc_gross_prices<vat_pl>(net, gross);
+        do_not_optimize(gross);
+    });
+}
@@ -0,0 +1,60 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <span>
+#include <vector>
+
+#include "polynomial.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    constexpr Polynomial pricing_curve{1.2e-9, -3.4e-7, 5.6e-5, -7.8e-3, 0.91, 10.0, 2.5, -0.75, 100.0};
+
+    // coefficients known only at runtime - the pre-Polynomial way
+    double runtime_horner(std::span<const double> coefficients, double x)
+    {
+        double result = 0.0;
+        for (double c : coefficients)
+            result = result * x + c;
+        return result;
+    }
+
+    std::vector<double> create_points(size_t count)
+    {
+        helpers::random::PCG rnd{665};
+        std::vector<double> points(count);
+        for (auto& x : points)
+            x = helpers::random::to_unit_float(rnd()) * 100.0;
+        return points;
+    }
+} // namespace
+
+HELPERS_BENCHMARK("polynomial - degree 8 over 1M points")
+{
+    const auto in = create_points(1'000'000);
+    std::vector<double> out(in.size());
+
+    bench.run("runtime coefficients - horner", [&] {
+        for (size_t i = 0; i < in.size(); ++i)
+            out[i] = runtime_horner(pricing_curve.coefficients, in[i]);
+        do_not_optimize(out);
+    });
+
+    bench.run("NTTP - horner, scalar loop", [&] {
+        for (size_t i = 0; i < in.size(); ++i)
+            out[i] = poly_eval<pricing_curve, PolyScheme::horner>(in[i]);
+        do_not_optimize(out);
+    });
+
+    bench.run("NTTP - poly_eval batch, horner", [&] {
+        poly_eval<pricing_curve, PolyScheme::horner>(in, std::span{out});
+        do_not_optimize(out);
+    });
+
+    bench.run("NTTP - poly_eval batch, estrin", [&] {
+        poly_eval<pricing_curve, PolyScheme::estrin>(in, std::span{out});
+        do_not_optimize(out);
+    });
+}
@@ -0,0 +1,68 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <string>
+#include <vector>
+
+#include "soa_vector.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    struct Person
+    {
+        int id;
+        std::string name;
+        double salary;
+        double height;
+    };
+} // namespace
+
+HELPERS_BENCHMARK("soa_vector vs std::vector<Person> - scans of one member, 1M people")
+{
+    constexpr size_t count = 1'000'000;
+
+    helpers::random::PCG rnd{50};
+    std::vector<Person> aos;
+    aos.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        aos.push_back({static_cast<int>(i), "Person " + std::to_string(i), 3000.0 + rnd() % 10'000, 1.5 + (rnd() % 500) / 1000.0});
+
+    soa_vector<Person> soa;
+    soa.append(aos);
+
+    bench.run("std::vector<Person> - sum of salary", [&] {
+        double total = 0.0;
+        for (const auto& p : aos)
+            total += p.salary;
+        do_not_optimize(total);
+    });
+
+    bench.run("soa_vector<Person> - sum of salary", [&] {
+        double total = 0.0;
+        for (double salary : soa.column<&Person::salary>())
+            total += salary;
+        do_not_optimize(total);
+    });
+
+    bench.run("std::vector<Person> - count taller than 1.8", [&] {
+        size_t tall = 0;
+        for (const auto& p : aos)
+            tall += p.height > 1.8;
+        do_not_optimize(tall);
+    });
+
+    bench.run("soa_vector<Person> - count taller than 1.8", [&] {
+        size_t tall = 0;
+        for (double height : soa.column<&Person::height>())
+            tall += height > 1.8;
+        do_not_optimize(tall);
+    });
+
+    bench.run("soa_vector<Person> - bulk append of 1M rows", [&] {
+        soa_vector<Person> copy;
+        copy.append(aos);
+        do_not_optimize(copy);
+    });
+}
@@ -0,0 +1,72 @@
+#include <benchmark.hpp>
+#include <random.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "static_sort.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    // pool of random inputs - every iteration copies the next one, so both variants pay the same copy
+    template <size_t N>
+    std::vector<std::array<int, N>> create_inputs(size_t count = 1024)
+    {
+        helpers::random::PCG rnd{N};
+        std::vector<std::array<int, N>> inputs(count);
+        for (auto& input : inputs)
+            std::ranges::generate(input, [&] { return static_cast<int>(rnd()); });
+        return inputs;
+    }
+
+    template <size_t N>
+    void bench_sort(helpers::benchmark::Runner& bench)
+    {
+        const auto inputs = create_inputs<N>();
+        const std::string size = "N = " + std::to_string(N);
+
+        size_t index = 0;
+        bench.run(size + " - std::ranges::sort", [&] {
+            auto data = inputs[index++ % inputs.size()];
+            std::ranges::sort(data);
+            do_not_optimize(data);
+        });
+
+        bench.run(size + " - static_sort", [&] {
+            auto data = inputs[index++ % inputs.size()];
+            static_sort(data);
+            do_not_optimize(data);
+        });
+    }
+} // namespace
+
+HELPERS_BENCHMARK("sort - std::array<int, N>")
+{
+    [&]<size_t... Ns>(std::index_sequence<Ns...>) {
+        (bench_sort<Ns + 2>(bench), ...);
+    }(std::make_index_sequence<63>{});
+}
+
+HELPERS_BENCHMARK("sort - std::vector<int> with 1M items")
+{
+    helpers::random::PCG rnd{665};
+    std::vector<int> input(1'000'000);
+    std::ranges::generate(input, [&] { return static_cast<int>(rnd()); });
+
+    bench.run("std::ranges::sort", [&] {
+        auto data = input;
+        std::ranges::sort(data);
+        do_not_optimize(data);
+    });
+
+    bench.run("network_merge_sort<16>", [&] {
+        auto data = input;
+        network_merge_sort(std::span{data});
+        do_not_optimize(data);
+    });
+}
@@ -0,0 +1,77 @@
+#include <benchmark.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+using helpers::benchmark::do_not_optimize;
+
+namespace
+{
+    std::atomic<size_t> allocation_count{0};
+}
+
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    constexpr size_t jobs = 10'000;
+
+    // a job with 40 bytes of captures - over the inline buffer of std::function (16 bytes in libstdc++)
+    template <typename Pool>
+    void submit_jobs(Pool& pool, std::vector<double>& results)
+    {
+        for (size_t i = 0; i < jobs; ++i)
+            pool.submit([&results, i, a = 1.5, b = 2.5, c = 3.5] { results[i] = a * b + c * static_cast<double>(i); });
+        pool.wait_idle();
+    }
+
+    template <typename Pool>
+    void bench_pool(helpers::benchmark::Runner& bench, std::string_view name)
+    {
+        Pool pool{2, 256};
+        std::vector<double> results(jobs);
+
+        const size_t before = allocation_count.load();
+        submit_jobs(pool, results);
+        const size_t allocations = allocation_count.load() - before;
+
+        const auto result = bench.run(name, [&] {
+            submit_jobs(pool, results);
+            do_not_optimize(results);
+        });
+
+        std::cout << std::format("    {:.1f} ns per job, {:.2f} allocations per job\n", result.ns_per_iteration.median / jobs,
+            static_cast<double>(allocations) / jobs);
+    }
+} // namespace
+
+HELPERS_BENCHMARK("thread pool - 10'000 small jobs")
+{
+    bench_pool<ThreadPool<std::function<void()>>>(bench, "std::function<void()> tasks");
+    bench_pool<ThreadPool<move_only_function<void()>>>(bench, "move_only_function<void()> tasks");
+    bench_pool<ThreadPool<inplace_function<void()>>>(bench, "inplace_function<void(), 48> tasks");
+}
@@ -0,0 +1,502 @@
+#ifndef FLAT_CONTAINERS_HPP
+#define FLAT_CONTAINERS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flat_details
+{
+    template <typename Compare>
+    concept Transparent = requires { typename Compare::is_transparent; };
+
+    // a range of keys, but not a single key - insert("abc") into flat_set<std::string> inserts one string
+    template <typename R, typename Key>
+    concept RangeOf = std::convertible_to<std::ranges::range_reference_t<R>, Key> && !std::convertible_to<R, Key>;
+
+    // lower_bound without a data-dependent branch - the loop runs log2(n) times for every key and the compare
+    // result is used as a number, not a condition (GCC turns `cond ? base + half : base` back into a jump),
+    // so there are no mispredictions and the next loads can start before the compare is resolved
+    template <typename T, typename K, typename Compare>
+    size_t branchless_lower_bound(std::span<const T> items, const K& key, const Compare& cmp)
+    {
+        if (items.empty())
+            return 0;
+
+        const T* base = items.data();
+        size_t length = items.size();
+        while (length > 1)
+        {
+            const size_t half = length / 2;
+            base += static_cast<size_t>(cmp(base[half - 1], key)) * half;
+            length -= half;
+        }
+        return (base - items.data()) + static_cast<size_t>(cmp(*base, key));
+    }
+} // namespace flat_details
+
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+// Set kept as a sorted std::vector - one allocation for all items, lookups touch only contiguous memory.
+// Compare may be a lambda type: flat_set<T, decltype(cmp)> default-constructs it (C++20).
+// Inserting one item is O(n) - fill with a bulk insert() and search many times.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set
+{
+    std::vector<Key> items_;
+    [[no_unique_address]] Compare cmp_;
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using size_type = size_t;
+    using iterator = typename std::vector<Key>::const_iterator;
+    using const_iterator = iterator;
+
+    flat_set() = default;
+
+    explicit flat_set(Compare cmp)
+        : cmp_{std::move(cmp)}
+    {
+    }
+
+    template <std::ranges::input_range R>
+        requires(!std::same_as<std::remove_cvref_t<R>, flat_set>) && flat_details::RangeOf<R, Key>
+    explicit flat_set(R&& items, Compare cmp = Compare{})
+        : cmp_{std::move(cmp)}
+    {
+        insert(std::forward<R>(items));
+    }
+
+    flat_set(std::initializer_list<Key> items, Compare cmp = Compare{})
+        : flat_set(std::span{items.begin(), items.size()}, std::move(cmp))
+    {
+    }
+
+    // items are already sorted and unique - no sorting (checked only in debug builds)
+    flat_set(sorted_unique_t, std::vector<Key> items, Compare cmp = Compare{})
+        : items_{std::move(items)}
+        , cmp_{std::move(cmp)}
+    {
+        assert(std::ranges::adjacent_find(items_, std::not_fn(cmp_)) == items_.end());
+    }
+
+    iterator begin() const noexcept
+    {
+        return items_.begin();
+    }
+
+    iterator end() const noexcept
+    {
+        return items_.end();
+    }
+
+    size_t size() const noexcept
+    {
+        return items_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return items_.empty();
+    }
+
+    void reserve(size_t capacity)
+    {
+        items_.reserve(capacity);
+    }
+
+    void clear() noexcept
+    {
+        items_.clear();
+    }
+
+    key_compare key_comp() const
+    {
+        return cmp_;
+    }
+
+    std::span<const Key> items() const noexcept
+    {
+        return items_;
+    }
+
+    std::pair<iterator, bool> insert(Key key)
+    {
+        const size_t index = lower_bound_index(key);
+        if (index < items_.size() && !cmp_(key, items_[index]))
+            return {items_.begin() + index, false};
+
+        return {items_.insert(items_.begin() + index, std::move(key)), true};
+    }
+
+    // bulk insert - append, sort the new items once, merge and remove duplicates
+    template <std::ranges::input_range R>
+        requires flat_details::RangeOf<R, Key>
+    void insert(R&& items)
+    {
+        const size_t sorted_size = items_.size();
+        if constexpr (std::ranges::sized_range<R>)
+            items_.reserve(sorted_size + std::ranges::size(items));
+
+        if constexpr (std::is_rvalue_reference_v<R&&>)
+            std::ranges::move(items, std::back_inserter(items_));
+        else
+            std::ranges::copy(items, std::back_inserter(items_));
+
+        const auto middle = items_.begin() + sorted_size;
+        std::stable_sort(middle, items_.end(), cmp_);
+        std::inplace_merge(items_.begin(), middle, items_.end(), cmp_);
+        items_.erase(std::unique(items_.begin(), items_.end(), equivalent()), items_.end());
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    size_t erase(const K& key)
+    {
+        const size_t index = lower_bound_index(key);
+        if (index == items_.size() || cmp_(key, items_[index]))
+            return 0;
+
+        items_.erase(items_.begin() + index);
+        return 1;
+    }
+
+    // heterogeneous lookup (find("text"sv) in flat_set<std::string, std::less<>>) needs a transparent Compare
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    iterator lower_bound(const K& key) const
+    {
+        return items_.begin() + lower_bound_index(key);
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    iterator find(const K& key) const
+    {
+        const auto it = lower_bound(key);
+        return it != end() && !cmp_(key, *it) ? it : end();
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    bool contains(const K& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    size_t count(const K& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    bool operator==(const flat_set& other) const
+    {
+        return items_ == other.items_;
+    }
+
+private:
+    template <typename K>
+    size_t lower_bound_index(const K& key) const
+    {
+        return flat_details::branchless_lower_bound(std::span<const Key>{items_}, key, cmp_);
+    }
+
+    auto equivalent() const
+    {
+        return [this](const Key& a, const Key& b) { return !cmp_(a, b) && !cmp_(b, a); };
+    }
+};
+
+template <std::ranges::input_range R, typename Compare = std::less<std::ranges::range_value_t<R>>>
+flat_set(R&&, Compare = Compare{}) -> flat_set<std::ranges::range_value_t<R>, Compare>;
+
+// Map with keys and values in two sorted vectors - the search scans only the keys.
+// Same interface rules as flat_set: bulk insert is cheap, a single insert/erase moves the tail.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map
+{
+    std::vector<Key> keys_;
+    std::vector<T> values_;
+    [[no_unique_address]] Compare cmp_;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using key_compare = Compare;
+    using size_type = size_t;
+
+    flat_map() = default;
+
+    explicit flat_map(Compare cmp)
+        : cmp_{std::move(cmp)}
+    {
+    }
+
+    flat_map(std::initializer_list<std::pair<Key, T>> items, Compare cmp = Compare{})
+        : cmp_{std::move(cmp)}
+    {
+        insert(std::span{items.begin(), items.size()});
+    }
+
+    size_t size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+
+    void reserve(size_t capacity)
+    {
+        keys_.reserve(capacity);
+        values_.reserve(capacity);
+    }
+
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    std::span<const Key> keys() const noexcept
+    {
+        return keys_;
+    }
+
+    std::span<const T> values() const noexcept
+    {
+        return values_;
+    }
+
+    std::span<T> values() noexcept
+    {
+        return values_;
+    }
+
+    // f(key, value) in key order
+    template <typename F>
+    void for_each(F f) const
+    {
+        for (size_t i = 0; i < keys_.size(); ++i)
+            f(keys_[i], values_[i]);
+    }
+
+    template <typename... Args>
+    bool try_emplace(Key key, Args&&... args)
+    {
+        const size_t index = lower_bound_index(key);
+        if (index < keys_.size() && !cmp_(key, keys_[index]))
+            return false;
+
+        emplace_at(index, std::move(key), std::forward<Args>(args)...);
+        return true;
+    }
+
+    template <typename V>
+    bool insert_or_assign(Key key, V&& value)
+    {
+        if (T* current = find(key))
+        {
+            *current = std::forward<V>(value);
+            return false;
+        }
+        return try_emplace(std::move(key), std::forward<V>(value));
+    }
+
+    T& operator[](const Key& key)
+    {
+        const size_t index = lower_bound_index(key);
+        if (index == keys_.size() || cmp_(key, keys_[index]))
+            emplace_at(index, key);
+        return values_[index];
+    }
+
+    // bulk insert of (key, value) pairs - new items are appended, then one stable sort and one merge of indices
+    // decide the final order; first occurrence of a key wins; on exception the map is left unchanged
+    template <std::ranges::input_range R>
+    void insert(R&& items)
+    {
+        // elements of an rvalue container or a range of prvalues are moved, elements of anything else are copied
+        constexpr bool move_items = !std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>
+            || (!std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>);
+
+        const size_t old_size = keys_.size();
+        try
+        {
+            if constexpr (std::ranges::sized_range<R>)
+                reserve(old_size + std::ranges::size(items));
+
+            for (auto&& item : items)
+            {
+                auto&& [key, value] = item;
+                if constexpr (move_items)
+                {
+                    keys_.emplace_back(std::move(key));
+                    values_.emplace_back(std::move(value));
+                }
+                else
+                {
+                    keys_.emplace_back(key);
+                    values_.emplace_back(value);
+                }
+            }
+
+            merge_appended(old_size);
+        }
+        catch (...)
+        {
+            truncate(old_size);
+            throw;
+        }
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    size_t erase(const K& key)
+    {
+        const size_t index = lower_bound_index(key);
+        if (index == keys_.size() || cmp_(key, keys_[index]))
+            return 0;
+
+        keys_.erase(keys_.begin() + index);
+        values_.erase(values_.begin() + index);
+        return 1;
+    }
+
+    // nullptr if the key is not in the map
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    T* find(const K& key)
+    {
+        const size_t index = lower_bound_index(key);
+        return index < keys_.size() && !cmp_(key, keys_[index]) ? &values_[index] : nullptr;
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    const T* find(const K& key) const
+    {
+        return const_cast<flat_map&>(*this).find(key);
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    bool contains(const K& key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    template <typename K = Key>
+        requires std::same_as<K, Key> || flat_details::Transparent<Compare>
+    const T& at(const K& key) const
+    {
+        if (const T* value = find(key))
+            return *value;
+
+        throw std::out_of_range("key not found");
+    }
+
+private:
+    template <typename K>
+    size_t lower_bound_index(const K& key) const
+    {
+        return flat_details::branchless_lower_bound(std::span<const Key>{keys_}, key, cmp_);
+    }
+
+    // key first, then the value - the key is erased again if the value throws, so both vectors keep the same size
+    template <typename K, typename... Args>
+    void emplace_at(size_t index, K&& key, Args&&... args)
+    {
+        keys_.insert(keys_.begin() + index, std::forward<K>(key));
+        try
+        {
+            values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            keys_.erase(keys_.begin() + index);
+            throw;
+        }
+    }
+
+    // [0, sorted_size) is sorted and unique, [sorted_size, size()) is in insertion order
+    void merge_appended(size_t sorted_size)
+    {
+        const size_t total_size = keys_.size();
+        auto by_key = [this](size_t a, size_t b) { return cmp_(keys_[a], keys_[b]); };
+
+        std::vector<size_t> order(total_size);
+        std::iota(order.begin(), order.end(), size_t{0});
+        const auto middle = order.begin() + sorted_size;
+        std::stable_sort(middle, order.end(), by_key);
+        std::inplace_merge(order.begin(), middle, order.end(), by_key); // stable - existing keys come first
+
+        // first occurrence of each key - nothing is moved yet, so a throwing compare leaves the map intact
+        size_t kept = 0;
+        for (size_t index : order)
+            if (kept == 0 || cmp_(keys_[order[kept - 1]], keys_[index]))
+                order[kept++] = index;
+        order.resize(kept);
+
+        // nothing to reorder when every new key is unique and greater than the existing ones
+        if (kept == total_size && std::ranges::equal(order, std::views::iota(size_t{0}, total_size)))
+            return;
+
+        // copies instead of moves when a move may throw; the vector that may throw is gathered first,
+        // so keys_ and values_ are still intact if it does
+        auto gather = [&order]<typename U>(std::vector<U>& source) {
+            std::vector<U> result;
+            result.reserve(order.size());
+            for (size_t index : order)
+                result.push_back(std::move_if_noexcept(source[index]));
+            return result;
+        };
+
+        std::vector<Key> keys;
+        std::vector<T> values;
+        if constexpr (std::is_nothrow_move_constructible_v<Key>)
+        {
+            values = gather(values_);
+            keys = gather(keys_);
+        }
+        else
+        {
+            keys = gather(keys_);
+            values = gather(values_);
+        }
+
+        keys_.swap(keys);
+        values_.swap(values);
+    }
+
+    // both vectors back to count elements after a failed insertion
+    void truncate(size_t count) noexcept
+    {
+        keys_.erase(keys_.begin() + std::min(count, keys_.size()), keys_.end());
+        values_.erase(values_.begin() + std::min(count, values_.size()), values_.end());
+    }
+};
+
+#endif
@@ -0,0 +1,227 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include <random.hpp>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flat_containers.hpp"
+
+using namespace std::literals;
+
+TEST_CASE("flat_set - lambda comparator")
+{
+    auto cmp_by_value = [](const auto& a, const auto& b) {
+        return *a < *b;
+    };
+
+    flat_set<std::shared_ptr<int>, decltype(cmp_by_value)> my_set; // default constructed comparer
+
+    CHECK(my_set.insert(std::make_shared<int>(42)).second);
+    CHECK(my_set.insert(std::make_shared<int>(1)).second);
+    CHECK(my_set.insert(std::make_shared<int>(665)).second);
+    CHECK_FALSE(my_set.insert(std::make_shared<int>(42)).second);
+
+    std::vector<int> values;
+    for (const auto& ptr : my_set)
+        values.push_back(*ptr);
+    CHECK(values == std::vector{1, 42, 665});
+
+    CHECK(my_set.contains(std::make_shared<int>(665)));
+    CHECK(my_set.erase(std::make_shared<int>(1)) == 1);
+    CHECK(my_set.erase(std::make_shared<int>(1)) == 0);
+    CHECK(my_set.size() == 2);
+}
+
+TEST_CASE("flat_set - bulk insert")
+{
+    flat_set<int> numbers{5, 3, 5, 1, 3};
+    CHECK(std::ranges::equal(numbers, std::vector{1, 3, 5}));
+
+    numbers.insert(std::vector{4, 1, 2, 4});
+    CHECK(std::ranges::equal(numbers, std::vector{1, 2, 3, 4, 5}));
+
+    flat_set sorted{sorted_unique, std::vector{1, 2, 3}};
+    CHECK(sorted.size() == 3);
+
+    SECTION("first of equivalent items is kept")
+    {
+        auto by_length = [](const std::string& a, const std::string& b) {
+            return a.size() < b.size();
+        };
+
+        flat_set<std::string, decltype(by_length)> words{"one", "three", "two"};
+        words.insert(std::vector{"six"s, "seven"s, "four"s});
+
+        CHECK(std::ranges::equal(words, std::vector{"one"s, "four"s, "three"s}));
+    }
+
+    SECTION("a string is one key, not a range of keys")
+    {
+        flat_set<std::string> words;
+
+        CHECK(words.insert("abc").second);
+        CHECK(words.insert(std::string{"xyz"sv}).second);
+        CHECK_FALSE(words.insert("abc"s).second);
+        CHECK(std::ranges::equal(words, std::vector{"abc"s, "xyz"s}));
+    }
+
+    SECTION("same items as std::set")
+    {
+        helpers::random::PCG rnd{48};
+        std::vector<int> data(10'000);
+        std::ranges::generate(data, [&] { return static_cast<int>(rnd() % 5000); });
+
+        const std::set<int> expected(data.begin(), data.end());
+        flat_set<int> flat{std::span{data}.first(3000)};
+        flat.insert(std::span{data}.subspan(3000));
+
+        CHECK(std::ranges::equal(flat, expected));
+        for (int key = -1; key <= 5000; ++key)
+            if (flat.contains(key) != expected.contains(key))
+                FAIL("different result for key " << key);
+    }
+}
+
+TEST_CASE("flat_set - heterogeneous lookup")
+{
+    flat_set<std::string, std::less<>> names{"Kowalski", "Nowak", "Anonim"};
+
+    CHECK(names.contains("Nowak"sv));  // no temporary std::string
+    CHECK(names.find("Nowa") == names.end());
+    CHECK(*names.lower_bound("B") == "Kowalski");
+    CHECK(names.erase("Anonim") == 1);
+    CHECK(names.count("Anonim"sv) == 0);
+}
+
+TEST_CASE("flat_map")
+{
+    flat_map<std::string, int, std::less<>> stock{{"pen", 10}, {"ink", 4}, {"pen", 99}};
+
+    CHECK(stock.size() == 2);
+    CHECK(stock.at("pen") == 10); // first occurrence wins
+    CHECK_THROWS_AS(stock.at("paper"), std::out_of_range);
+
+    stock["paper"] += 500;
+    CHECK(stock.insert_or_assign("ink", 5) == false);
+    CHECK(stock.try_emplace("ink", 0) == false);
+    CHECK(stock.try_emplace("eraser", 1));
+
+    stock.insert(std::vector<std::pair<std::string, int>>{{"stapler", 2}, {"pen", 0}, {"clip", 100}});
+
+    CHECK(std::ranges::equal(stock.keys(), std::vector{"clip"s, "eraser"s, "ink"s, "paper"s, "pen"s, "stapler"s}));
+    CHECK(std::ranges::equal(stock.values(), std::vector{100, 1, 5, 500, 10, 2}));
+
+    REQUIRE(stock.find("ink"sv) != nullptr);
+    *stock.find("ink"sv) = 7;
+    CHECK(stock.at("ink") == 7);
+
+    CHECK(stock.erase("eraser"sv) == 1);
+    CHECK_FALSE(stock.contains("eraser"));
+
+    int total = 0;
+    stock.for_each([&](const std::string&, int count) { total += count; });
+    CHECK(total == 100 + 7 + 500 + 10 + 2);
+}
+
+TEST_CASE("flat_map - bulk insert")
+{
+    SECTION("elements of an rvalue range are moved")
+    {
+        flat_map<int, std::unique_ptr<int>> owners;
+        owners.try_emplace(2, std::make_unique<int>(20));
+
+        std::vector<std::pair<int, std::unique_ptr<int>>> items;
+        items.emplace_back(3, std::make_unique<int>(30));
+        items.emplace_back(1, std::make_unique<int>(10));
+        items.emplace_back(2, std::make_unique<int>(0));
+        owners.insert(std::move(items));
+
+        CHECK(std::ranges::equal(owners.keys(), std::vector{1, 2, 3}));
+        CHECK(*owners.at(1) == 10);
+        CHECK(*owners.at(2) == 20);
+        CHECK(*owners.at(3) == 30);
+    }
+
+    SECTION("elements of an lvalue range are copied")
+    {
+        flat_map<std::string, std::string> words;
+        std::vector<std::pair<std::string, std::string>> items{{"b", "bee"}, {"a", "ant"}};
+        words.insert(items);
+
+        CHECK(std::ranges::equal(words.keys(), std::vector{"a"s, "b"s}));
+        CHECK(items[0].second == "bee");
+    }
+
+    SECTION("a throwing copy leaves the map unchanged")
+    {
+        struct ThrowsOnCopy
+        {
+            int value = 0;
+            bool throws = false;
+
+            ThrowsOnCopy(int v, bool t = false)
+                : value{v}
+                , throws{t}
+            {
+            }
+
+            ThrowsOnCopy(const ThrowsOnCopy& other)
+                : value{other.value}
+                , throws{other.throws}
+            {
+                if (throws)
+                    throw std::runtime_error("copy");
+            }
+
+            ThrowsOnCopy& operator=(const ThrowsOnCopy&) = default;
+        };
+
+        flat_map<int, ThrowsOnCopy> map;
+        map.try_emplace(5, 50);
+
+        std::vector<std::pair<int, ThrowsOnCopy>> items;
+        items.reserve(2);
+        items.emplace_back(1, 10);
+        items.emplace_back(std::piecewise_construct, std::forward_as_tuple(7), std::forward_as_tuple(70, true));
+        CHECK_THROWS_AS(map.insert(items), std::runtime_error);
+
+        REQUIRE(map.size() == 1);
+        CHECK(map.keys()[0] == 5);
+        CHECK(map.values()[0].value == 50);
+    }
+}
+
+TEST_CASE("flat_map - a throwing value constructor keeps keys and values in step")
+{
+    struct Fragile
+    {
+        int value = 0;
+
+        Fragile()
+        {
+            throw std::runtime_error("default");
+        }
+
+        Fragile(int v)
+            : value{v}
+        {
+            if (v < 0)
+                throw std::runtime_error("negative");
+        }
+    };
+
+    flat_map<int, Fragile> map;
+    map.try_emplace(1, 10);
+    map.try_emplace(3, 30);
+
+    CHECK_THROWS_AS(map.try_emplace(2, -1), std::runtime_error);
+    CHECK_THROWS_AS(map[0], std::runtime_error);
+
+    REQUIRE(map.values().size() == map.keys().size());
+    CHECK(std::ranges::equal(map.keys(), std::vector{1, 3}));
+    CHECK(map.at(3).value == 30);
+}
@@ -0,0 +1,168 @@
+#ifndef INPLACE_FUNCTION_HPP
+#define INPLACE_FUNCTION_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace function_details
+{
+    template <typename R, typename... Args>
+    struct VTable
+    {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*relocate)(void* from, void* to) noexcept; // move-constructs at `to` and destroys `from`
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename F, typename R, typename... Args>
+    inline constexpr VTable<R, Args...> inplace_vtable{
+        [](void* storage, Args&&... args) -> R {
+            return std::invoke(*static_cast<F*>(storage), std::forward<Args>(args)...);
+        },
+        [](void* from, void* to) noexcept {
+            ::new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        },
+        [](void* storage) noexcept {
+            static_cast<F*>(storage)->~F();
+        }};
+
+    // storage keeps only F* - relocation copies the pointer
+    template <typename F, typename R, typename... Args>
+    inline constexpr VTable<R, Args...> heap_vtable{
+        [](void* storage, Args&&... args) -> R {
+            return std::invoke(**static_cast<F**>(storage), std::forward<Args>(args)...);
+        },
+        [](void* from, void* to) noexcept {
+            ::new (to) F*(*static_cast<F**>(from));
+        },
+        [](void* storage) noexcept {
+            delete *static_cast<F**>(storage);
+        }};
+
+    template <typename Signature, size_t Capacity, bool HeapFallback>
+    class Function;
+
+    // Type-erased, move-only callable with Capacity bytes of inline storage.
+    // Callables that fit (and are nothrow movable) are stored in place - no allocation;
+    // bigger ones go to the heap if HeapFallback, otherwise they do not compile.
+    template <typename R, typename... Args, size_t Capacity, bool HeapFallback>
+    class Function<R(Args...), Capacity, HeapFallback>
+    {
+        static_assert(Capacity >= sizeof(void*));
+
+        alignas(std::max_align_t) std::byte storage_[Capacity];
+        const VTable<R, Args...>* vtable_ = nullptr;
+
+    public:
+        using result_type = R;
+
+        template <typename F>
+        static constexpr bool stored_inplace
+            = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+        Function() noexcept = default;
+
+        Function(std::nullptr_t) noexcept
+        {
+        }
+
+        template <typename F>
+            requires(!std::same_as<std::remove_cvref_t<F>, Function>) && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+        Function(F&& f)
+        {
+            using Fn = std::decay_t<F>;
+
+            if constexpr (stored_inplace<Fn>)
+            {
+                ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+                vtable_ = &inplace_vtable<Fn, R, Args...>;
+            }
+            else
+            {
+                static_assert(HeapFallback && sizeof(Fn) > 0, "callable does not fit the inline storage - increase Capacity");
+                ::new (static_cast<void*>(storage_)) Fn*(new Fn(std::forward<F>(f)));
+                vtable_ = &heap_vtable<Fn, R, Args...>;
+            }
+        }
+
+        Function(const Function&) = delete;
+        Function& operator=(const Function&) = delete;
+
+        Function(Function&& other) noexcept
+        {
+            take(other);
+        }
+
+        Function& operator=(Function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+        Function& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        ~Function()
+        {
+            reset();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return vtable_ != nullptr;
+        }
+
+        R operator()(Args... args)
+        {
+            if (!vtable_)
+                throw std::bad_function_call{};
+
+            return vtable_->invoke(storage_, std::forward<Args>(args)...);
+        }
+
+        void swap(Function& other) noexcept
+        {
+            Function temp{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+    private:
+        void take(Function& other) noexcept
+        {
+            if (other.vtable_)
+            {
+                other.vtable_->relocate(other.storage_, storage_);
+                vtable_ = std::exchange(other.vtable_, nullptr);
+            }
+        }
+
+        void reset() noexcept
+        {
+            if (vtable_)
+                std::exchange(vtable_, nullptr)->destroy(storage_);
+        }
+    };
+} // namespace function_details
+
+// never allocates - a callable bigger than Capacity is a compile error
+template <typename Signature, size_t Capacity = 48>
+using inplace_function = function_details::Function<Signature, Capacity, false>;
+
+// like std::function, but accepts move-only callables; small ones (up to 3 pointers) are stored in place
+template <typename Signature>
+using move_only_function = function_details::Function<Signature, 3 * sizeof(void*), true>;
+
+#endif
@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "inplace_function.hpp"
+
+namespace
+{
+    // counts live copies - checks that moved-from and destroyed callables are cleaned up
+    struct Tracked
+    {
+        static inline int alive = 0;
+
+        int value;
+
+        explicit Tracked(int v)
+            : value{v}
+        {
+            ++alive;
+        }
+
+        Tracked(Tracked&& other) noexcept
+            : value{other.value}
+        {
+            ++alive;
+        }
+
+        ~Tracked()
+        {
+            --alive;
+        }
+
+        int operator()(int x) const
+        {
+            return value + x;
+        }
+    };
+} // namespace
+
+TEST_CASE("inplace_function")
+{
+    SECTION("move-only captures")
+    {
+        auto ptr = std::make_unique<int>(42);
+        inplace_function<int(int)> f = [ptr = std::move(ptr)](int x) { return *ptr + x; };
+        // std::function<int(int)> g = std::move(f); // ERROR - std::function requires a copyable callable
+
+        CHECK(f(1) == 43);
+
+        auto g = std::move(f);
+        CHECK_FALSE(f);
+        CHECK(g(2) == 44);
+        CHECK_THROWS_AS(f(0), std::bad_function_call);
+    }
+
+    SECTION("lifetime of the stored callable")
+    {
+        Tracked::alive = 0;
+        {
+            inplace_function<int(int), 16> f{Tracked{10}};
+            CHECK(Tracked::alive == 1);
+
+            inplace_function<int(int), 16> g;
+            g = std::move(f);
+            CHECK(Tracked::alive == 1);
+            CHECK(g(5) == 15);
+
+            g = [](int x) { return x; };
+            CHECK(Tracked::alive == 0);
+            CHECK(g(5) == 5);
+
+            f = Tracked{1};
+            f.swap(g);
+            CHECK(f(1) == 1);
+            CHECK(g(1) == 2);
+        }
+        CHECK(Tracked::alive == 0);
+    }
+
+    SECTION("capacity is checked at compile time")
+    {
+        using SmallFunction = inplace_function<void(), 16>;
+
+        static_assert(SmallFunction::stored_inplace<decltype([a = 1, b = 2.0] {})>);
+        static_assert(!SmallFunction::stored_inplace<decltype([a = std::array<int, 5>{}] {})>);
+        // SmallFunction f = [a = std::array<int, 5>{}] {}; // ERROR - callable does not fit the inline storage
+    }
+
+    SECTION("results and arguments")
+    {
+        inplace_function<std::string(std::string&&, const std::string&)> concat = [](std::string&& a, const std::string& b) {
+            return std::move(a) + b;
+        };
+        const std::string suffix = "!";
+        CHECK(concat("hello", suffix) == "hello!");
+
+        inplace_function<int(int, int)> plus = std::plus{};
+        CHECK(plus(2, 3) == 5);
+    }
+}
+
+TEST_CASE("move_only_function - big callables go to the heap")
+{
+    Tracked::alive = 0;
+    {
+        std::array<long, 16> big{};
+        big[15] = 7;
+
+        move_only_function<long()> f = [big, tracked = Tracked{0}] { return big[15]; };
+        static_assert(!decltype(f)::stored_inplace<decltype([big] { return big[15]; })>);
+
+        auto g = std::move(f);
+        CHECK(g() == 7);
+        CHECK(Tracked::alive == 1);
+
+        move_only_function<int(int)> small = Tracked{1};
+        CHECK(small(1) == 2);
+    }
+    CHECK(Tracked::alive == 0);
+}
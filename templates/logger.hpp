@@ -0,0 +1,475 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <compiled_format.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <output.hpp>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+template <size_t N>
+struct Str
+{
+    char value[N];
+
+    constexpr Str(const char (&str)[N])
+    {
+        std::copy(str, str + N, value);
+    }
+
+    constexpr std::string_view view() const
+    {
+        return {value, N - 1};
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Str& str)
+    {
+        out << str.value;
+
+        return out;
+    }
+
+    auto operator<=>(const Str& other) const = default; // implicitly constexpr
+};
+
+// Asynchronous logging with deferred formatting:
+//  - the caller copies raw arguments into a fixed-size record in its own SPSC ring (no lock, no formatting)
+//  - a background thread drains all rings, formats records with helpers::fmt_string and writes them in batches
+//  - prefix and format string are template arguments - the decoder of a record is an instantiation that has them baked in
+// Records from one thread keep their order; records from different threads may interleave.
+namespace logging
+{
+    inline constexpr size_t record_size = 256;
+    inline constexpr size_t ring_capacity = 1024; // records per thread
+
+    // copied as bytes and formatted later - strings are copied into the record, or to the heap when they do not fit
+    template <typename T>
+    concept StringLike = std::convertible_to<const T&, std::string_view>;
+
+    template <typename T>
+    concept Loggable = StringLike<T> || std::is_arithmetic_v<T> || (std::is_trivially_copyable_v<T> && helpers::Formattable<T>);
+
+    namespace details
+    {
+        struct Record
+        {
+            using Decoder = void (*)(const std::byte* payload, std::string& out);
+
+            Decoder decode;
+            std::byte payload[record_size - sizeof(Decoder)];
+        };
+
+        static_assert(sizeof(Record) == record_size);
+
+        inline constexpr size_t payload_capacity = sizeof(Record::payload);
+
+        // a string is stored as its size and text, or as spilled_string and a heap copy that the backend frees after formatting
+        inline constexpr std::uint32_t spilled_string = std::numeric_limits<std::uint32_t>::max();
+        inline constexpr size_t string_slot = sizeof(std::uint32_t) + sizeof(std::string*);
+
+        struct StoredString
+        {
+            std::string_view text;
+            std::unique_ptr<std::string> spilled;
+        };
+
+        template <typename T>
+        using stored_t = std::conditional_t<StringLike<T>, StoredString, T>;
+
+        template <typename T>
+        const auto& formatted(const T& item)
+        {
+            if constexpr (std::same_as<T, StoredString>)
+                return item.text;
+            else
+                return item;
+        }
+
+        // bytes used by the arguments if every string was spilled to the heap
+        template <typename... TArgs>
+        inline constexpr size_t fixed_size = ((StringLike<TArgs> ? string_slot : sizeof(TArgs)) + ... + 0);
+
+        // single producer (the owning thread), single consumer (the backend)
+        class alignas(64) ThreadRing
+        {
+        public:
+            // waits (yields) while the ring is full - records are never dropped
+            Record& claim()
+            {
+                const size_t tail = tail_.load(std::memory_order_relaxed);
+                while (tail - cached_head_ == ring_capacity)
+                {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                    if (tail - cached_head_ == ring_capacity)
+                        std::this_thread::yield();
+                }
+                return records_[tail % ring_capacity];
+            }
+
+            void publish()
+            {
+                tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            // consumer: formats up to max_count records into out; returns position to pass to release()
+            size_t drain(std::string& out, size_t max_count)
+            {
+                const size_t head = head_.load(std::memory_order_relaxed);
+                const size_t tail = std::min(tail_.load(std::memory_order_acquire), head + max_count);
+
+                for (size_t i = head; i != tail; ++i)
+                {
+                    const Record& record = records_[i % ring_capacity];
+                    record.decode(record.payload, out);
+                }
+                return tail;
+            }
+
+            // slots are reused only after their text was written
+            void release(size_t position)
+            {
+                head_.store(position, std::memory_order_release);
+            }
+
+            bool drained_up_to(size_t position) const
+            {
+                return head_.load(std::memory_order_acquire) >= position;
+            }
+
+            size_t published() const
+            {
+                return tail_.load(std::memory_order_acquire);
+            }
+
+        private:
+            alignas(64) std::atomic<size_t> tail_{0};
+            size_t cached_head_{0};
+            alignas(64) std::atomic<size_t> head_{0};
+            std::vector<Record> records_ = std::vector<Record>(ring_capacity);
+        };
+
+        template <typename T>
+        void encode(std::byte*& out, size_t& string_budget, const T& value)
+        {
+            if constexpr (StringLike<T>)
+            {
+                const std::string_view text{value};
+                if (text.size() <= sizeof(std::string*) + string_budget)
+                {
+                    const auto size = static_cast<std::uint32_t>(text.size());
+                    std::memcpy(out, &size, sizeof(size));
+                    std::memcpy(out + sizeof(size), text.data(), size);
+                    out += sizeof(size) + size;
+                    string_budget -= std::max(text.size(), sizeof(std::string*)) - sizeof(std::string*);
+                }
+                else
+                {
+                    const std::string* spilled = new std::string{text};
+                    std::memcpy(out, &spilled_string, sizeof(spilled_string));
+                    std::memcpy(out + sizeof(spilled_string), &spilled, sizeof(spilled));
+                    out += string_slot;
+                }
+            }
+            else
+            {
+                std::memcpy(out, &value, sizeof(T));
+                out += sizeof(T);
+            }
+        }
+
+        template <typename T>
+        stored_t<T> decode_argument(const std::byte*& in)
+        {
+            if constexpr (StringLike<T>)
+            {
+                std::uint32_t size;
+                std::memcpy(&size, in, sizeof(size));
+                if (size == spilled_string)
+                {
+                    std::string* spilled;
+                    std::memcpy(&spilled, in + sizeof(size), sizeof(spilled));
+                    in += string_slot;
+                    return StoredString{*spilled, std::unique_ptr<std::string>{spilled}};
+                }
+
+                const std::string_view text{reinterpret_cast<const char*>(in + sizeof(size)), size};
+                in += sizeof(size) + size;
+                return StoredString{text, nullptr};
+            }
+            else
+            {
+                T value;
+                std::memcpy(&value, in, sizeof(T));
+                in += sizeof(T);
+                return value;
+            }
+        }
+
+        template <Str Prefix, helpers::FixedString Fmt, typename... TArgs>
+        void decode([[maybe_unused]] const std::byte* payload, std::string& out) // unused for formats without arguments
+        {
+            // braced init - arguments are read left to right
+            const std::tuple<stored_t<TArgs>...> args{decode_argument<TArgs>(payload)...};
+
+            out.append(Prefix.view());
+            std::apply(
+                [&](const auto&... items) {
+                    char buffer[1024];
+                    const size_t size = helpers::fmt_string<Fmt>::format_to(buffer, formatted(items)...);
+                    if (size <= sizeof(buffer))
+                        out.append(buffer, size);
+                    else
+                        out.append(helpers::fmt_string<Fmt>::format(formatted(items)...));
+                },
+                args);
+            out.push_back('\n');
+        }
+
+        class Backend
+        {
+        public:
+            static constexpr size_t batch_size = 256; // records per ring per round
+            static constexpr auto idle_sleep = std::chrono::microseconds{100};
+
+            Backend()
+                : writer_{[this](std::stop_token stop) { run(stop); }}
+            {
+            }
+
+            ~Backend()
+            {
+                writer_.request_stop();
+                writer_.join();
+            }
+
+            std::shared_ptr<ThreadRing> register_thread()
+            {
+                auto ring = std::make_shared<ThreadRing>();
+                std::scoped_lock lk{mtx_};
+                rings_.push_back(ring);
+                return ring;
+            }
+
+            void set_output(helpers::OutputSink sink)
+            {
+                flush();
+                std::scoped_lock lk{sink_mtx_};
+                sink_ = sink;
+            }
+
+            // waits until everything logged so far (by any thread) is written to the sink
+            void flush()
+            {
+                std::vector<std::pair<std::shared_ptr<ThreadRing>, size_t>> targets;
+                {
+                    std::scoped_lock lk{mtx_};
+                    for (const auto& ring : rings_)
+                        targets.emplace_back(ring, ring->published());
+                }
+
+                for (const auto& [ring, position] : targets)
+                    while (!ring->drained_up_to(position))
+                        std::this_thread::yield();
+            }
+
+        private:
+            std::mutex mtx_; // guards rings_
+            std::vector<std::shared_ptr<ThreadRing>> rings_;
+            std::mutex sink_mtx_; // guards sink_
+            helpers::OutputSink sink_{std::cout};
+            std::jthread writer_; // last - starts after other members are initialized
+
+            void run(std::stop_token stop)
+            {
+                std::string batch;
+                std::vector<std::shared_ptr<ThreadRing>> rings;
+                std::vector<size_t> positions;
+
+                while (true)
+                {
+                    const bool stopping = stop.stop_requested();
+
+                    {
+                        std::scoped_lock lk{mtx_};
+                        rings = rings_;
+                    }
+
+                    // this thread is the only consumer - rings are drained and formatted without the lock,
+                    // so register_thread() never waits for formatting or I/O
+                    batch.clear();
+                    positions.clear();
+                    for (const auto& ring : rings)
+                        positions.push_back(ring->drain(batch, batch_size));
+
+                    if (!batch.empty())
+                    {
+                        std::scoped_lock lk{sink_mtx_};
+                        sink_.write(batch);
+                        sink_.flush();
+                    }
+
+                    for (size_t i = 0; i < rings.size(); ++i)
+                        rings[i]->release(positions[i]);
+                    rings.clear();
+
+                    {
+                        // threads that exited and were fully drained
+                        std::scoped_lock lk{mtx_};
+                        std::erase_if(rings_, [](const auto& ring) { return ring.use_count() == 1 && ring->drained_up_to(ring->published()); });
+                    }
+
+                    if (batch.empty())
+                    {
+                        if (stopping)
+                            return;
+
+                        std::this_thread::sleep_for(idle_sleep);
+                    }
+                }
+            }
+        };
+
+        inline Backend& backend()
+        {
+            static Backend instance;
+            return instance;
+        }
+
+        inline ThreadRing& thread_ring()
+        {
+            thread_local std::shared_ptr<ThreadRing> ring = backend().register_thread();
+            return *ring;
+        }
+    } // namespace details
+
+    // hot path: copies arguments into a ring slot - formatting and I/O happen on the background thread
+    template <Str Prefix, helpers::FixedString Fmt, Loggable... TArgs>
+    void write(const TArgs&... args)
+    {
+        static_assert(helpers::fmt_string<Fmt>::argument_count == sizeof...(TArgs), "number of arguments does not match the format string");
+        static_assert(details::fixed_size<TArgs...> <= details::payload_capacity, "arguments do not fit in a log record");
+
+        auto& ring = details::thread_ring();
+        details::Record& record = ring.claim();
+
+        record.decode = &details::decode<Prefix, Fmt, TArgs...>;
+
+        [[maybe_unused]] std::byte* out = record.payload; // unused for formats without arguments
+        [[maybe_unused]] size_t string_budget = details::payload_capacity - details::fixed_size<TArgs...>;
+        (details::encode(out, string_budget, args), ...);
+
+        ring.publish();
+    }
+
+    inline void flush()
+    {
+        details::backend().flush();
+    }
+
+    // default - std::cout
+    inline void set_output(helpers::OutputSink sink)
+    {
+        details::backend().set_output(sink);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // levels
+
+    enum class Level : std::uint8_t
+    {
+        trace,
+        debug,
+        info,
+        warning,
+        error,
+        off
+    };
+
+    // build flag: -DLOGGING_MIN_LEVEL=<0..5> - statements below it are compiled out
+#ifdef LOGGING_MIN_LEVEL
+    inline constexpr Level compile_time_threshold = static_cast<Level>(LOGGING_MIN_LEVEL);
+#elif defined(NDEBUG)
+    inline constexpr Level compile_time_threshold = Level::info;
+#else
+    inline constexpr Level compile_time_threshold = Level::trace;
+#endif
+
+    // per category - specialize to compile out a noisy category:
+    //   template <> inline constexpr logging::Level logging::category_threshold<"[net] "> = logging::Level::warning;
+    template <Str Category>
+    inline constexpr Level category_threshold = compile_time_threshold;
+
+    // adjustable at runtime - one relaxed load of a rarely written byte and one branch per statement
+    template <Str Category>
+    inline std::atomic<Level> runtime_threshold{Level::trace};
+
+    template <Str Category>
+    void set_level(Level level)
+    {
+        runtime_threshold<Category>.store(level, std::memory_order_relaxed);
+    }
+} // namespace logging
+
+template <Str LogPrefix, logging::Level LogLevel = logging::Level::info>
+struct Logger
+{
+    // false - log() is an empty function, LOGGER_LOG() does not evaluate its arguments
+    static constexpr bool compiled_in = LogLevel >= logging::category_threshold<LogPrefix> && LogLevel != logging::Level::off;
+
+    static bool enabled() noexcept
+    {
+        if constexpr (compiled_in)
+            return LogLevel >= logging::runtime_threshold<LogPrefix>.load(std::memory_order_relaxed);
+        else
+            return false;
+    }
+
+    void log(std::string_view msg) const
+    {
+        if constexpr (compiled_in)
+        {
+            if (enabled())
+                logging::write<LogPrefix, "{}">(msg);
+        }
+    }
+
+    // logger.log<"x = {}, y = {}">(x, y) - arguments are formatted on the background thread
+    template <helpers::FixedString Fmt, logging::Loggable... TArgs>
+    void log(const TArgs&... args) const
+    {
+        if constexpr (compiled_in)
+        {
+            if (enabled())
+                logging::write<LogPrefix, Fmt>(args...);
+        }
+    }
+};
+
+// LOGGER_LOG(trace_logger, "i = {}", expensive(i)) - arguments are evaluated only if the statement is enabled;
+// compiled out statements leave no code and no branch
+#define LOGGER_LOG(logger, fmt, ...)                                                \
+    do                                                                              \
+    {                                                                               \
+        if constexpr (std::remove_cvref_t<decltype(logger)>::compiled_in)           \
+        {                                                                           \
+            if (std::remove_cvref_t<decltype(logger)>::enabled())                   \
+                (logger).template log<fmt>(__VA_ARGS__);                            \
+        }                                                                           \
+    } while (false)
+
+#endif
@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger.hpp"
+
+namespace
+{
+    std::vector<std::string> lines(const std::string& text)
+    {
+        std::vector<std::string> result;
+        std::istringstream in{text};
+        for (std::string line; std::getline(in, line);)
+            result.push_back(line);
+        return result;
+    }
+
+    // captures output of the background thread for one test
+    struct CapturedLog
+    {
+        std::ostringstream out;
+
+        CapturedLog()
+        {
+            logging::set_output(out);
+        }
+
+        ~CapturedLog()
+        {
+            logging::set_output(std::cout);
+        }
+
+        std::string text()
+        {
+            logging::flush();
+            return out.str();
+        }
+    };
+} // namespace
+
+TEST_CASE("Logger - deferred formatting")
+{
+    CapturedLog log;
+
+    Logger<"[app] "> logger;
+    logger.log("started");
+    logger.log<"x = {}, y = {}, ok = {}">(42, 0.5, true);
+
+    std::string name = "temporary";
+    logger.log<"name: {}, char: {}">(name, 'c');
+    name = "changed"; // the argument was copied
+
+    logger.log<"no arguments">();
+
+    CHECK(lines(log.text())
+        == std::vector<std::string>{"[app] started", "[app] x = 42, y = 0.5, ok = true", "[app] name: temporary, char: c", "[app] no arguments"});
+}
+
+TEST_CASE("Logger - long strings are written in full")
+{
+    CapturedLog log;
+
+    const std::string long_text(1000, 'a');
+    const std::string medium_text(200, 'b');
+    Logger<""> logger;
+    logger.log<"{}|{}">(long_text, 7);
+    logger.log<"{}|{}|{}">(medium_text, medium_text, "end"); // the second one does not fit in the record
+    logger.log(long_text);
+
+    CHECK(lines(log.text()) == std::vector<std::string>{long_text + "|7", medium_text + "|" + medium_text + "|end", long_text});
+}
+
+TEST_CASE("Logger - many threads")
+{
+    CapturedLog log;
+
+    constexpr int thread_count = 4;
+    constexpr int per_thread = 5000; // more than ring_capacity - producers wait for the backend
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < thread_count; ++t)
+            threads.emplace_back([t] {
+                Logger<"T"> logger;
+                for (int i = 0; i < per_thread; ++i)
+                    logger.log<"{}:{}">(t, i);
+            });
+    }
+
+    const auto logged = lines(log.text());
+    REQUIRE(logged.size() == thread_count * per_thread);
+
+    // order is kept per thread
+    for (int t = 0; t < thread_count; ++t)
+    {
+        const std::string prefix = "T" + std::to_string(t) + ":";
+        int expected = 0;
+        bool in_order = true;
+        for (const auto& line : logged)
+            if (line.starts_with(prefix))
+                in_order = in_order && line == prefix + std::to_string(expected++);
+        CHECK(in_order);
+        CHECK(expected == per_thread);
+    }
+}
+
+template <>
+inline constexpr logging::Level logging::category_threshold<"[quiet] "> = logging::Level::error;
+
+namespace
+{
+    int evaluations = 0;
+
+    int expensive(int value)
+    {
+        ++evaluations;
+        return value;
+    }
+} // namespace
+
+TEST_CASE("Logger - compile-time levels and categories")
+{
+    static_assert(Logger<"[net] ", logging::Level::debug>::compiled_in == (logging::compile_time_threshold <= logging::Level::debug));
+    static_assert(Logger<"[quiet] ", logging::Level::warning>::compiled_in == false);
+    static_assert(Logger<"[quiet] ", logging::Level::error>::compiled_in);
+    static_assert(Logger<"[net] ", logging::Level::off>::compiled_in == false);
+
+    CapturedLog log;
+    evaluations = 0;
+
+    Logger<"[quiet] ", logging::Level::warning> quiet_warning;
+    Logger<"[quiet] ", logging::Level::error> quiet_error;
+
+    LOGGER_LOG(quiet_warning, "{}", expensive(1)); // compiled out - not evaluated
+    LOGGER_LOG(quiet_error, "{}", expensive(2));
+    quiet_warning.log("compiled out");
+
+    CHECK(evaluations == 1);
+    CHECK(log.text() == "[quiet] 2\n");
+}
+
+TEST_CASE("Logger - runtime threshold")
+{
+    CapturedLog log;
+    evaluations = 0;
+
+    Logger<"[db] ", logging::Level::info> info;
+    Logger<"[db] ", logging::Level::error> error;
+
+    logging::set_level<"[db] ">(logging::Level::warning);
+
+    LOGGER_LOG(info, "{}", expensive(1)); // disabled - not evaluated
+    LOGGER_LOG(error, "{}", expensive(2));
+    info.log("disabled");
+
+    logging::set_level<"[db] ">(logging::Level::trace);
+    info.log("enabled");
+    LOGGER_LOG(info, "no arguments");
+
+    CHECK(evaluations == 1);
+    CHECK(lines(log.text()) == std::vector<std::string>{"[db] 2", "[db] enabled", "[db] no arguments"});
+}
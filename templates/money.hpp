@@ -0,0 +1,334 @@
+#ifndef MONEY_HPP
+#define MONEY_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+struct Tax
+{
+    double value;
+
+    constexpr Tax(double v)
+        : value{v}
+    {
+        assert(value >= 0 && v < 1);
+    }
+};
+
+namespace money_details
+{
+    // int64 arithmetic that throws std::overflow_error instead of wrapping
+#if defined(__GNUC__) || defined(__clang__)
+    constexpr std::int64_t checked_add(std::int64_t a, std::int64_t b)
+    {
+        std::int64_t result;
+        if (__builtin_add_overflow(a, b, &result))
+            throw std::overflow_error("decimal overflow");
+        return result;
+    }
+
+    constexpr std::int64_t checked_sub(std::int64_t a, std::int64_t b)
+    {
+        std::int64_t result;
+        if (__builtin_sub_overflow(a, b, &result))
+            throw std::overflow_error("decimal overflow");
+        return result;
+    }
+
+    constexpr std::int64_t checked_mul(std::int64_t a, std::int64_t b)
+    {
+        std::int64_t result;
+        if (__builtin_mul_overflow(a, b, &result))
+            throw std::overflow_error("decimal overflow");
+        return result;
+    }
+#else
+    inline constexpr std::int64_t int64_max = std::numeric_limits<std::int64_t>::max();
+    inline constexpr std::int64_t int64_min = std::numeric_limits<std::int64_t>::min();
+
+    constexpr std::int64_t checked_add(std::int64_t a, std::int64_t b)
+    {
+        if ((b > 0 && a > int64_max - b) || (b < 0 && a < int64_min - b))
+            throw std::overflow_error("decimal overflow");
+        return a + b;
+    }
+
+    constexpr std::int64_t checked_sub(std::int64_t a, std::int64_t b)
+    {
+        if ((b < 0 && a > int64_max + b) || (b > 0 && a < int64_min + b))
+            throw std::overflow_error("decimal overflow");
+        return a - b;
+    }
+
+    constexpr std::int64_t checked_mul(std::int64_t a, std::int64_t b)
+    {
+        const bool overflow = a > 0 ? (b > 0 ? a > int64_max / b : b < int64_min / a)
+                                    : (b > 0 ? a < int64_min / b : a != 0 && b < int64_max / a);
+        if (overflow)
+            throw std::overflow_error("decimal overflow");
+        return a * b;
+    }
+#endif
+} // namespace money_details
+
+// Fixed-point decimal: value == units / 10^Scale. Arithmetic is exact - overflow throws std::overflow_error,
+// rounding happens only in operations that need it (applying a rate) and is half away from zero.
+// Structural type - can be used as NTTP.
+template <int Scale>
+struct Decimal
+{
+    static_assert(Scale >= 0 && Scale <= 9);
+
+    static constexpr std::int64_t one = [] {
+        std::int64_t result = 1;
+        for (int i = 0; i < Scale; ++i)
+            result *= 10;
+        return result;
+    }();
+
+    std::int64_t units = 0;
+
+    static constexpr Decimal from_units(std::int64_t units)
+    {
+        return Decimal{units};
+    }
+
+    // "12.34", "-0.5", "7" - at most Scale fractional digits, digits required on both sides of the point
+    static constexpr Decimal parse(std::string_view text)
+    {
+        const bool negative = !text.empty() && text.front() == '-';
+        if (negative)
+            text.remove_prefix(1);
+
+        if (text.empty())
+            throw std::invalid_argument("empty decimal");
+        if (text.front() == '.')
+            throw std::invalid_argument("digits expected before the decimal point");
+
+        std::int64_t units = 0;
+        int fraction_digits = -1;
+        for (char c : text)
+        {
+            if (c == '.' && fraction_digits < 0)
+            {
+                fraction_digits = 0;
+                continue;
+            }
+            if (c < '0' || c > '9')
+                throw std::invalid_argument("invalid character in decimal");
+            if (fraction_digits >= 0 && ++fraction_digits > Scale)
+                throw std::invalid_argument("too many fractional digits");
+            units = money_details::checked_add(money_details::checked_mul(units, 10), c - '0');
+        }
+
+        if (fraction_digits == 0)
+            throw std::invalid_argument("digits expected after the decimal point");
+
+        for (int i = std::max(fraction_digits, 0); i < Scale; ++i)
+            units = money_details::checked_mul(units, 10);
+
+        return Decimal{negative ? -units : units};
+    }
+
+    constexpr std::int64_t whole() const
+    {
+        return units / one;
+    }
+
+    std::string to_string() const
+    {
+        const std::uint64_t magnitude = units < 0 ? 0 - static_cast<std::uint64_t>(units) : static_cast<std::uint64_t>(units);
+
+        std::string result = std::to_string(magnitude / one);
+        if constexpr (Scale > 0)
+        {
+            std::string fraction = std::to_string(magnitude % one);
+            result += '.';
+            result.append(Scale - fraction.size(), '0');
+            result += fraction;
+        }
+        return units < 0 ? "-" + result : result;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const Decimal& value)
+    {
+        return out << value.to_string();
+    }
+
+    auto operator<=>(const Decimal&) const = default;
+
+    constexpr Decimal operator-() const
+    {
+        return Decimal{money_details::checked_sub(0, units)};
+    }
+
+    friend constexpr Decimal operator+(Decimal a, Decimal b)
+    {
+        return Decimal{money_details::checked_add(a.units, b.units)};
+    }
+
+    friend constexpr Decimal operator-(Decimal a, Decimal b)
+    {
+        return Decimal{money_details::checked_sub(a.units, b.units)};
+    }
+
+    // price * quantity
+    friend constexpr Decimal operator*(Decimal a, std::int64_t factor)
+    {
+        return Decimal{money_details::checked_mul(a.units, factor)};
+    }
+
+    friend constexpr Decimal operator*(std::int64_t factor, Decimal a)
+    {
+        return a * factor;
+    }
+
+    constexpr Decimal& operator+=(Decimal other)
+    {
+        return *this = *this + other;
+    }
+
+    constexpr Decimal& operator-=(Decimal other)
+    {
+        return *this = *this - other;
+    }
+};
+
+using Money = Decimal<2>;
+
+namespace money_literals
+{
+    // 19.99_money - the literal is read as text, never as a double
+    template <char... Chars>
+    consteval Money operator""_money()
+    {
+        constexpr char text[] = {Chars...};
+        return Money::parse(std::string_view{text, sizeof...(Chars)});
+    }
+} // namespace money_literals
+
+namespace money_details
+{
+    // rates are exact to 1/10'000 (basis points) - 0.23, 0.055, 0.077
+    inline constexpr std::int64_t rate_denominator = 10'000;
+
+    template <Tax Vat>
+    inline constexpr std::int64_t basis_points = [] {
+        const double scaled = Vat.value * rate_denominator;
+        const auto result = static_cast<std::int64_t>(scaled + 0.5);
+        if (scaled - result > 1e-6 || result - scaled > 1e-6)
+            throw std::invalid_argument("VAT rate must be a whole number of basis points");
+        return result;
+    }();
+
+    // amount * (denominator + bp) / denominator rounded half away from zero - exact for any int64 amount, no 128-bit type:
+    // units = q * denominator + r, so the result is q * factor + round(r * factor / denominator);
+    // q and r have the sign of units, so rounding the small part rounds the whole one
+    template <std::int64_t BasisPoints>
+    constexpr std::int64_t apply_rate(std::int64_t units)
+    {
+        constexpr std::int64_t factor = rate_denominator + BasisPoints;
+
+        const std::int64_t q = units / rate_denominator;
+        const std::int64_t r = units % rate_denominator;
+
+        const std::int64_t fraction = r * factor; // |r * factor| < 10'000 * 20'000
+        const std::int64_t magnitude = (fraction < 0 ? -fraction : fraction) + rate_denominator / 2;
+        const std::int64_t rounded = fraction < 0 ? -(magnitude / rate_denominator) : magnitude / rate_denominator;
+
+        return checked_add(checked_mul(q, factor), rounded);
+    }
+
+    // Fast path for |units| < 2^37 in doubles - every step is exact or provably rounds to the exact result:
+    //  - units and units * (denominator + bp) < 2^53 are exact
+    //  - q = product / denominator has |q| < 2^38, so q is within 2^-15 of the exact quotient whose fraction is a multiple of 1/10'000
+    //  - nearest(|q|) is the exact rounding except for ties (fraction exactly .5, computed exactly) - those go up
+    // Integer <-> double conversions add and subtract 1.5 * 2^52, sign handling is fabs/copysign - no branches,
+    // so the loop vectorizes with SSE2.
+    inline constexpr std::int64_t fast_path_limit = std::int64_t{1} << 37;
+
+    // |units| < 2^37 for all units - or-reduction of (units + 2^37) >> 38, SSE2 has no 64-bit compares;
+    // the sum is unsigned - wraps instead of overflowing for units near INT64_MAX
+    inline bool fit_fast_path(std::span<const std::int64_t> units)
+    {
+        std::uint64_t out_of_range = 0;
+        for (std::int64_t u : units)
+            out_of_range |= (static_cast<std::uint64_t>(u) + static_cast<std::uint64_t>(fast_path_limit)) >> 38;
+        return out_of_range == 0;
+    }
+
+    template <std::int64_t BasisPoints>
+    inline std::int64_t apply_rate_fast(std::int64_t units)
+    {
+        constexpr double magic = 0x1.8p52;
+        constexpr std::int64_t magic_bits = std::bit_cast<std::int64_t>(magic);
+        constexpr double factor = static_cast<double>(rate_denominator + BasisPoints);
+
+        const double amount = std::bit_cast<double>(units + magic_bits) - magic;
+        const double q = amount * factor / static_cast<double>(rate_denominator);
+        const double magnitude = std::fabs(q);
+
+        double rounded = (magnitude + magic) - magic; // nearest, ties to even
+        rounded += static_cast<double>(magnitude - rounded == 0.5);
+
+        return std::bit_cast<std::int64_t>(std::copysign(rounded, q) + magic) - magic_bits;
+    }
+} // namespace money_details
+
+template <Tax Vat>
+constexpr Money calc_gross_price(Money net_price)
+{
+    return Money::from_units(money_details::apply_rate<money_details::basis_points<Vat>>(net_price.units));
+}
+
+// gross[i] = calc_gross_price<Vat>(net[i]) - blocks of 16 prices in doubles when all fit the exact fast path,
+// the local block cannot alias the spans, so the compiler vectorizes it without runtime checks
+template <Tax Vat>
+void calc_gross_prices(std::span<const Money> net, std::span<Money> gross)
+{
+    if (gross.size() < net.size())
+        throw std::length_error("output span is too small");
+
+    static_assert(sizeof(Money) == sizeof(std::int64_t) && std::is_trivially_copyable_v<Money>);
+
+    constexpr std::int64_t bp = money_details::basis_points<Vat>;
+    constexpr size_t lanes = 16;
+
+    size_t i = 0;
+    for (; i + lanes <= net.size(); i += lanes)
+    {
+        std::array<std::int64_t, lanes> block;
+        std::memcpy(block.data(), net.data() + i, sizeof(block)); // Money is a single int64
+
+        if (money_details::fit_fast_path(block))
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+                block[lane] = money_details::apply_rate_fast<bp>(block[lane]);
+            std::memcpy(static_cast<void*>(gross.data() + i), block.data(), sizeof(block));
+        }
+        else
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+                gross[i + lane] = calc_gross_price<Vat>(net[i + lane]);
+        }
+    }
+
+    for (; i < net.size(); ++i)
+        gross[i] = calc_gross_price<Vat>(net[i]);
+}
+
+#endif
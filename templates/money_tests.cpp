@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random.hpp>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "money.hpp"
+
+using namespace money_literals;
+
+namespace
+{
+    constexpr Tax vat_pl{0.23};
+    constexpr Tax vat_reduced{0.055};
+} // namespace
+
+TEST_CASE("Money - exact decimal arithmetic")
+{
+    static_assert(19.99_money == Money::from_units(1999));
+    static_assert(0.1_money + 0.2_money == 0.3_money); // 0.1 + 0.2 != 0.3 in double
+    static_assert(-(5_money) == Money::parse("-5.00"));
+    static_assert(12.5_money * 3 == 37.5_money);
+
+    CHECK((0.1_money + 0.2_money).to_string() == "0.30");
+    CHECK(Money::parse("-0.05").to_string() == "-0.05");
+    CHECK(Money::from_units(std::numeric_limits<std::int64_t>::min()).to_string() == "-92233720368547758.08");
+
+    CHECK_THROWS_AS(Money::parse("1.234"), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse("12a"), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse("-"), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse("."), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse("-."), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse("1."), std::invalid_argument);
+    CHECK_THROWS_AS(Money::parse(".5"), std::invalid_argument);
+    CHECK(Money::parse("1.5") == 1.50_money);
+    CHECK_THROWS_AS(Money::from_units(std::numeric_limits<std::int64_t>::max()) + 0.01_money, std::overflow_error);
+    CHECK_THROWS_AS(Money::from_units(std::numeric_limits<std::int64_t>::max() / 2) * 3, std::overflow_error);
+}
+
+TEST_CASE("Money - gross price with compile-time VAT")
+{
+    static_assert(calc_gross_price<vat_pl>(100_money) == 123_money);
+
+    CHECK(calc_gross_price<vat_pl>(0.01_money) == 0.01_money);  // 0.0123 -> 0.01
+    CHECK(calc_gross_price<vat_pl>(0.50_money) == 0.62_money);  // 0.615 -> 0.62, half away from zero
+    CHECK(calc_gross_price<vat_pl>(-0.50_money) == -0.62_money);
+    CHECK(calc_gross_price<vat_reduced>(0.10_money) == 0.11_money); // 0.1055
+    CHECK(calc_gross_price<vat_reduced>(1.00_money) == 1.06_money); // 1.055 - double gives 1.05
+    CHECK_THROWS_AS(calc_gross_price<vat_pl>(Money::from_units(std::numeric_limits<std::int64_t>::max() / 10 * 9)), std::overflow_error);
+    CHECK_THROWS_AS(calc_gross_price<vat_pl>(Money::from_units(std::numeric_limits<std::int64_t>::min() / 10 * 9)), std::overflow_error);
+}
+
+#ifdef __SIZEOF_INT128__
+TEST_CASE("Money - apply_rate matches 128-bit arithmetic")
+{
+    constexpr std::int64_t bp = money_details::basis_points<vat_pl>;
+
+    auto reference = [](std::int64_t units) -> std::optional<std::int64_t> {
+        const __int128 product = static_cast<__int128>(units) * (money_details::rate_denominator + bp);
+        const __int128 magnitude = product < 0 ? -product : product;
+        const __int128 rounded = (magnitude + money_details::rate_denominator / 2) / money_details::rate_denominator;
+        const __int128 result = product < 0 ? -rounded : rounded;
+        if (result > std::numeric_limits<std::int64_t>::max() || result < std::numeric_limits<std::int64_t>::min())
+            return std::nullopt;
+        return static_cast<std::int64_t>(result);
+    };
+
+    auto exact = [](std::int64_t units) -> std::optional<std::int64_t> {
+        try
+        {
+            return money_details::apply_rate<bp>(units);
+        }
+        catch (const std::overflow_error&)
+        {
+            return std::nullopt;
+        }
+    };
+
+    helpers::random::PCG rnd{128};
+    bool all_equal = true;
+    for (int i = 0; i < 100'000; ++i)
+    {
+        const auto units = static_cast<std::int64_t>((std::uint64_t{rnd()} << 32) | rnd()) >> (rnd() % 64);
+        all_equal = all_equal && exact(units) == reference(units);
+    }
+    // around the overflow limit: INT64_MAX / 1.23
+    for (std::int64_t delta = -20'000; delta <= 20'000; ++delta)
+    {
+        const std::int64_t units = std::numeric_limits<std::int64_t>::max() / 12'300 * 10'000 + delta;
+        all_equal = all_equal && exact(units) == reference(units) && exact(-units) == reference(-units);
+    }
+    CHECK(all_equal);
+}
+#endif
+
+TEST_CASE("Money - batch gross prices match the exact scalar version")
+{
+    helpers::random::PCG rnd{2024};
+
+    std::vector<Money> net;
+    // halves and near-halves of the rounding, both signs, values around the fast path limit
+    for (std::int64_t units = -2000; units <= 2000; ++units)
+        net.push_back(Money::from_units(units));
+    for (std::int64_t base : {std::int64_t{1} << 37, std::int64_t{1} << 50, std::int64_t{1} << 36})
+        for (std::int64_t delta = -40; delta <= 40; ++delta)
+        {
+            net.push_back(Money::from_units(base + delta));
+            net.push_back(Money::from_units(-base - delta));
+        }
+    // rnd() gives 32 bits - two draws for the whole fast path range [-2^37, 2^37) and around 2^38
+    auto random_units = [&](int bits) {
+        const std::uint64_t value = (std::uint64_t{rnd()} << 32) | rnd();
+        return static_cast<std::int64_t>(value % (std::uint64_t{1} << bits)) - (std::int64_t{1} << (bits - 1));
+    };
+    for (int i = 0; i < 100'000; ++i)
+        net.push_back(Money::from_units(random_units(38)));
+    for (int i = 0; i < 1000; ++i)
+        net.push_back(Money::from_units(random_units(40)));
+    for (std::int64_t units : {std::numeric_limits<std::int64_t>::max() / 4, std::numeric_limits<std::int64_t>::min() / 4})
+        net.push_back(Money::from_units(units)); // out of the fast path, no overflow in apply_rate
+
+    std::vector<Money> gross(net.size());
+
+    calc_gross_prices<vat_pl>(net, gross);
+    bool all_equal = true;
+    for (size_t i = 0; i < net.size(); ++i)
+        all_equal = all_equal && gross[i] == calc_gross_price<vat_pl>(net[i]);
+    CHECK(all_equal);
+
+    calc_gross_prices<vat_reduced>(net, gross);
+    all_equal = true;
+    for (size_t i = 0; i < net.size(); ++i)
+        all_equal = all_equal && gross[i] == calc_gross_price<vat_reduced>(net[i]);
+    CHECK(all_equal);
+
+    constexpr auto int64_max = std::numeric_limits<std::int64_t>::max();
+    const std::int64_t extremes[] = {int64_max, int64_max - (std::int64_t{1} << 37) + 1, std::numeric_limits<std::int64_t>::min()};
+    CHECK_FALSE(money_details::fit_fast_path(extremes));
+    const std::int64_t limits[] = {(std::int64_t{1} << 37) - 1, -(std::int64_t{1} << 37)};
+    CHECK(money_details::fit_fast_path(limits));
+
+    std::vector<Money> too_small(3);
+    CHECK_THROWS_AS(calc_gross_prices<vat_pl>(net, too_small), std::length_error);
+}
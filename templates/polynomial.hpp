@@ -0,0 +1,123 @@
+#ifndef POLYNOMIAL_HPP
+#define POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Generalization of Factors/SinceCpp20::poly_calculate from templates.cpp to any degree.
+// Coefficients are ordered like in Factors - from the highest power: Polynomial{A, B, C} == A * x^2 + B * x + C.
+// Polynomial is a structural type - passed as NTTP its coefficients become immediates in the generated code.
+template <typename T, size_t N>
+struct Polynomial
+{
+    static_assert(N > 0, "polynomial needs at least one coefficient");
+
+    std::array<T, N> coefficients;
+
+    static constexpr size_t degree()
+    {
+        return N - 1;
+    }
+
+    constexpr T operator[](size_t power) const
+    {
+        return coefficients[N - 1 - power];
+    }
+};
+
+template <typename T, std::same_as<T>... Ts>
+Polynomial(T, Ts...) -> Polynomial<T, 1 + sizeof...(Ts)>;
+
+enum class PolyScheme
+{
+    horner, // shortest code, one dependent multiply-add per coefficient
+    estrin  // pairs evaluated independently - dependency chain of log2(degree) steps
+};
+
+namespace polynomial_details
+{
+    template <auto f>
+    inline constexpr PolyScheme default_scheme = f.degree() >= 6 ? PolyScheme::estrin : PolyScheme::horner;
+
+    // f(int) with double coefficients is computed in double - the coefficients are never narrowed to X
+    template <auto f, typename X>
+    using result_t = std::common_type_t<X, typename decltype(f.coefficients)::value_type>;
+
+    template <auto f, typename R, size_t... Is>
+    constexpr R horner([[maybe_unused]] R x, std::index_sequence<Is...>) // x is unused for degree 0
+    {
+        R result = f.coefficients[0];
+        ((result = result * x + f.coefficients[Is + 1]), ...);
+        return result;
+    }
+
+    // coefficients from the lowest power: p(x) = (a0 + a1 * x) + (a2 + a3 * x) * x^2 + ... - recursively in x^2
+    template <typename X, size_t N>
+    constexpr X estrin(const std::array<X, N>& a, X x)
+    {
+        if constexpr (N == 1)
+        {
+            return a[0];
+        }
+        else
+        {
+            auto pairs = [&]<size_t... Is>(std::index_sequence<Is...>) {
+                if constexpr (N % 2 == 0)
+                    return std::array<X, N / 2>{(a[2 * Is] + a[2 * Is + 1] * x)...};
+                else
+                    return std::array<X, N / 2 + 1>{(a[2 * Is] + a[2 * Is + 1] * x)..., a[N - 1]};
+            }(std::make_index_sequence<N / 2>{});
+
+            return estrin(pairs, x * x);
+        }
+    }
+
+    template <auto f, typename R, size_t... Is>
+    constexpr R estrin(R x, std::index_sequence<Is...>)
+    {
+        constexpr size_t n = sizeof...(Is);
+        return estrin(std::array<R, n>{f.coefficients[n - 1 - Is]...}, x);
+    }
+} // namespace polynomial_details
+
+template <auto f, PolyScheme Scheme = polynomial_details::default_scheme<f>, typename X>
+constexpr polynomial_details::result_t<f, X> poly_eval(X x)
+{
+    using R = polynomial_details::result_t<f, X>;
+    constexpr size_t n = f.coefficients.size();
+
+    if constexpr (Scheme == PolyScheme::horner)
+        return polynomial_details::horner<f, R>(x, std::make_index_sequence<n - 1>{});
+    else
+        return polynomial_details::estrin<f, R>(x, std::make_index_sequence<n>{});
+}
+
+// out[i] = f(in[i]) - the inner loop has a fixed trip count and no dependencies between lanes,
+// so it is vectorized without -ffast-math; X is deduced from out only and each result is converted to X
+template <auto f, PolyScheme Scheme = polynomial_details::default_scheme<f>, typename X>
+void poly_eval(std::type_identity_t<std::span<const X>> in, std::span<X> out)
+{
+    assert(out.size() >= in.size());
+
+    constexpr size_t lanes = 16;
+
+    size_t i = 0;
+    for (; i + lanes <= in.size(); i += lanes)
+    {
+        std::array<X, lanes> block; // local block cannot alias in - no runtime alias checks needed
+        for (size_t lane = 0; lane < lanes; ++lane)
+            block[lane] = static_cast<X>(poly_eval<f, Scheme>(in[i + lane]));
+        std::ranges::copy(block, out.begin() + i);
+    }
+
+    for (; i < in.size(); ++i)
+        out[i] = static_cast<X>(poly_eval<f, Scheme>(in[i]));
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "polynomial.hpp"
+
+namespace
+{
+    constexpr Polynomial linear_f{0.0, 1.0, 1.0}; // same as Factors linear_f in templates.cpp
+    constexpr Polynomial cubic_f{2.0, -3.0, 0.5, 4.0};
+    constexpr Polynomial degree_9_f{1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0, -10.0};
+
+    template <auto f>
+    double naive_eval(double x)
+    {
+        double result = 0.0;
+        for (size_t power = 0; power <= f.degree(); ++power)
+            result += f[power] * std::pow(x, power);
+        return result;
+    }
+
+    bool approx_equal(double a, double b)
+    {
+        return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+    }
+} // namespace
+
+TEST_CASE("Polynomial - NTTP of any degree")
+{
+    static_assert(linear_f.degree() == 2);
+    static_assert(degree_9_f.degree() == 9);
+    static_assert(cubic_f[0] == 4.0);
+    static_assert(cubic_f[3] == 2.0);
+
+    SECTION("constexpr evaluation")
+    {
+        static_assert(poly_eval<linear_f>(1.0) == 2.0);
+        static_assert(poly_eval<cubic_f>(2.0) == 16.0 - 12.0 + 1.0 + 4.0);
+        static_assert(poly_eval<Polynomial{7}>(3) == 7);
+        static_assert(poly_eval<Polynomial{1, 2, 3}, PolyScheme::estrin>(2) == 11);
+    }
+
+    SECTION("integer argument with floating point coefficients")
+    {
+        constexpr Polynomial f{1.5, 2.0, 0.5};
+
+        static_assert(std::same_as<decltype(poly_eval<f>(3)), double>);
+        static_assert(poly_eval<f, PolyScheme::horner>(3) == 20.0);
+        static_assert(poly_eval<f, PolyScheme::estrin>(3) == 20.0);
+        CHECK(poly_eval<f>(3) == 20.0);
+    }
+
+    SECTION("horner & estrin match the definition")
+    {
+        for (double x : {-2.5, -1.0, 0.0, 0.25, 1.0, 1.5, 3.0})
+        {
+            CHECK(approx_equal(poly_eval<cubic_f, PolyScheme::horner>(x), naive_eval<cubic_f>(x)));
+            CHECK(approx_equal(poly_eval<cubic_f, PolyScheme::estrin>(x), naive_eval<cubic_f>(x)));
+            CHECK(approx_equal(poly_eval<degree_9_f, PolyScheme::horner>(x), naive_eval<degree_9_f>(x)));
+            CHECK(approx_equal(poly_eval<degree_9_f, PolyScheme::estrin>(x), naive_eval<degree_9_f>(x)));
+        }
+    }
+
+    SECTION("integer coefficients are exact")
+    {
+        constexpr Polynomial f{3, 0, -1, 0, 2, 5, 1};
+
+        for (int x = -5; x <= 5; ++x)
+            CHECK(poly_eval<f, PolyScheme::horner>(x) == poly_eval<f, PolyScheme::estrin>(x));
+    }
+}
+
+TEST_CASE("poly_eval - batch")
+{
+    std::vector<double> in(1000 + 7);
+    std::iota(in.begin(), in.end(), -500.0);
+    for (auto& x : in)
+        x /= 100.0;
+
+    std::vector<double> out(in.size());
+    poly_eval<degree_9_f>(in, std::span{out});
+
+    for (size_t i = 0; i < in.size(); ++i)
+        CHECK(out[i] == poly_eval<degree_9_f>(in[i]));
+
+    SECTION("float input with double coefficients")
+    {
+        const std::array<float, 3> xs = {0.0f, 1.0f, 2.0f};
+        std::array<float, 3> ys{};
+
+        poly_eval<linear_f>(xs, std::span<float>{ys});
+
+        CHECK(ys == std::array{1.0f, 2.0f, 3.0f});
+    }
+}
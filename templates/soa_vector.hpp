@@ -0,0 +1,367 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace soa_details
+{
+    // converts to anything - T{Any{}, Any{}, ...} compiles only up to the number of members of aggregate T
+    struct Any
+    {
+        template <typename U>
+        operator U() const;
+    };
+
+    template <typename T, size_t... Is>
+    constexpr bool constructible_from_n(std::index_sequence<Is...>)
+    {
+        return requires { T{(static_cast<void>(Is), Any{})...}; };
+    }
+
+    inline constexpr size_t max_member_count = 8;
+
+    template <typename T, size_t N = max_member_count>
+    constexpr size_t member_count()
+    {
+        if constexpr (N == 0 || constructible_from_n<T>(std::make_index_sequence<N>{}))
+            return N;
+        else
+            return member_count<T, N - 1>();
+    }
+
+    // tuple of references to the members of an aggregate (structured bindings)
+    template <typename T>
+    constexpr auto tie_members(T& obj)
+    {
+        constexpr size_t count = member_count<std::remove_const_t<T>>();
+        static_assert(count > 0 && count <= max_member_count, "aggregate with 1-8 members expected");
+
+        if constexpr (count == 1)
+        {
+            auto& [m0] = obj;
+            return std::tie(m0);
+        }
+        else if constexpr (count == 2)
+        {
+            auto& [m0, m1] = obj;
+            return std::tie(m0, m1);
+        }
+        else if constexpr (count == 3)
+        {
+            auto& [m0, m1, m2] = obj;
+            return std::tie(m0, m1, m2);
+        }
+        else if constexpr (count == 4)
+        {
+            auto& [m0, m1, m2, m3] = obj;
+            return std::tie(m0, m1, m2, m3);
+        }
+        else if constexpr (count == 5)
+        {
+            auto& [m0, m1, m2, m3, m4] = obj;
+            return std::tie(m0, m1, m2, m3, m4);
+        }
+        else if constexpr (count == 6)
+        {
+            auto& [m0, m1, m2, m3, m4, m5] = obj;
+            return std::tie(m0, m1, m2, m3, m4, m5);
+        }
+        else if constexpr (count == 7)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6] = obj;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6);
+        }
+        else
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7] = obj;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7);
+        }
+    }
+
+    template <typename T>
+    using member_types = decltype(tie_members(std::declval<T&>()));
+
+    // never defined - only addresses of its members are compared at compile time
+    template <typename T>
+    struct FakeObject
+    {
+        T value;
+    };
+
+    template <typename T>
+    extern const FakeObject<T> fake_object;
+
+    // position of the member pointed by Member in the aggregate
+    template <auto Member, typename T>
+    consteval size_t member_index()
+    {
+        const auto members = tie_members(fake_object<T>.value);
+        const auto* address = &(fake_object<T>.value.*Member);
+
+        size_t index = 0;
+        bool found = false;
+        std::apply(
+            [&](const auto&... member) {
+                ((found = found || static_cast<const void*>(&member) == static_cast<const void*>(address), index += !found), ...);
+            },
+            members);
+        return index;
+    }
+
+    // std::vector<bool> packs bits and cannot be viewed as std::span<bool> - bool members are stored in bytes
+    struct Bool
+    {
+        bool value = false;
+
+        constexpr Bool(bool v = false) noexcept
+            : value{v}
+        {
+        }
+
+        constexpr operator bool() const noexcept
+        {
+            return value;
+        }
+    };
+
+    template <typename M>
+    using column_value_t = std::conditional_t<std::same_as<M, bool>, Bool, M>;
+
+    template <typename T>
+    struct Columns;
+
+    template <typename... Ms>
+    struct Columns<std::tuple<Ms&...>>
+    {
+        using type = std::tuple<std::vector<column_value_t<Ms>>...>;
+    };
+} // namespace soa_details
+
+template <typename T>
+concept SoaAggregate = std::is_aggregate_v<T> && soa_details::member_count<T>() > 0;
+
+// Structure of arrays: each member of aggregate T is stored in its own vector.
+// A scan over one member (column<&Person::salary>()) reads only that member's contiguous array.
+// Rows are accessed through proxies: rows[i].get<&Person::salary>() or Person p = rows[i].
+// Supported: aggregates with 1-8 members, no base classes, no C-array members.
+// bool members are stored as soa_details::Bool (one byte, converts to and from bool) - column() returns std::span<Bool>.
+template <SoaAggregate T>
+class soa_vector
+{
+    using Columns = typename soa_details::Columns<soa_details::member_types<T>>::type;
+    static constexpr size_t column_count = std::tuple_size_v<Columns>;
+
+    Columns columns_;
+
+    template <size_t... Is>
+    void push_back_members(std::index_sequence<Is...>, auto&& members)
+    {
+        const size_t old_size = size();
+        try
+        {
+            (std::get<Is>(columns_).push_back(std::get<Is>(std::forward<decltype(members)>(members))), ...);
+        }
+        catch (...)
+        {
+            truncate(old_size); // columns pushed before the throwing one
+            throw;
+        }
+    }
+
+    // all columns back to the same size after a failed insertion
+    void truncate(size_t count) noexcept
+    {
+        std::apply([count](auto&... column) { (column.erase(column.begin() + count, column.end()), ...); }, columns_);
+    }
+
+public:
+    using value_type = T;
+
+    template <auto Member>
+    static constexpr size_t index_of = soa_details::member_index<Member, T>();
+
+    template <auto Member>
+    using member_type = std::remove_reference_t<std::tuple_element_t<index_of<Member>, soa_details::member_types<T>>>;
+
+    // member_type, except soa_details::Bool for bool members
+    template <auto Member>
+    using column_type = soa_details::column_value_t<member_type<Member>>;
+
+    template <bool IsConst>
+    class basic_row
+    {
+        using Owner = std::conditional_t<IsConst, const soa_vector, soa_vector>;
+
+        Owner* owner_;
+        size_t index_;
+
+    public:
+        basic_row(Owner& owner, size_t index)
+            : owner_{&owner}
+            , index_{index}
+        {
+        }
+
+        template <auto Member>
+        decltype(auto) get() const
+        {
+            return owner_->template column<Member>()[index_];
+        }
+
+        // copy of the whole row
+        operator T() const
+        {
+            return owner_->get(index_);
+        }
+
+        const basic_row& operator=(const T& value) const
+            requires(!IsConst)
+        {
+            owner_->set(index_, value);
+            return *this;
+        }
+    };
+
+    using row_reference = basic_row<false>;
+    using const_row_reference = basic_row<true>;
+
+    soa_vector() = default;
+
+    soa_vector(std::initializer_list<T> rows)
+    {
+        append(rows);
+    }
+
+    size_t size() const noexcept
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(size_t capacity)
+    {
+        std::apply([capacity](auto&... column) { (column.reserve(capacity), ...); }, columns_);
+    }
+
+    void clear() noexcept
+    {
+        std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+    }
+
+    void push_back(const T& row)
+    {
+        push_back_members(std::make_index_sequence<column_count>{}, soa_details::tie_members(row));
+    }
+
+    void push_back(T&& row)
+    {
+        auto members = soa_details::tie_members(row);
+        push_back_members(std::make_index_sequence<column_count>{},
+            std::apply([](auto&... member) { return std::forward_as_tuple(std::move(member)...); }, members));
+    }
+
+    // bulk append - column by column, every column is written sequentially once
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, const T&>
+    void append(R&& rows)
+    {
+        if constexpr (std::ranges::forward_range<R> && std::ranges::sized_range<R>)
+        {
+            const size_t old_size = size();
+            reserve(old_size + std::ranges::size(rows));
+            try
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    (append_column<Is>(rows), ...);
+                }(std::make_index_sequence<column_count>{});
+            }
+            catch (...)
+            {
+                truncate(old_size);
+                throw;
+            }
+        }
+        else
+        {
+            for (const T& row : rows)
+                push_back(row);
+        }
+    }
+
+    template <auto Member>
+    std::span<column_type<Member>> column() noexcept
+    {
+        return std::get<index_of<Member>>(columns_);
+    }
+
+    template <auto Member>
+    std::span<const column_type<Member>> column() const noexcept
+    {
+        return std::get<index_of<Member>>(columns_);
+    }
+
+    row_reference operator[](size_t index)
+    {
+        return {*this, index};
+    }
+
+    const_row_reference operator[](size_t index) const
+    {
+        return {*this, index};
+    }
+
+    row_reference at(size_t index)
+    {
+        check_index(index);
+        return {*this, index};
+    }
+
+    const_row_reference at(size_t index) const
+    {
+        check_index(index);
+        return {*this, index};
+    }
+
+    T get(size_t index) const
+    {
+        return std::apply([index](const auto&... column) { return T{column[index]...}; }, columns_);
+    }
+
+    void set(size_t index, const T& value)
+    {
+        [&]<size_t... Is>(std::index_sequence<Is...>) {
+            const auto members = soa_details::tie_members(value);
+            ((std::get<Is>(columns_)[index] = std::get<Is>(members)), ...);
+        }(std::make_index_sequence<column_count>{});
+    }
+
+private:
+    template <size_t I, typename R>
+    void append_column(R& rows)
+    {
+        auto& column = std::get<I>(columns_);
+        for (const T& row : rows)
+            column.push_back(std::get<I>(soa_details::tie_members(row)));
+    }
+
+    void check_index(size_t index) const
+    {
+        if (index >= size())
+            throw std::out_of_range("row index out of range");
+    }
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "soa_vector.hpp"
+
+namespace hr
+{
+    struct Person
+    {
+        int id;
+        std::string name;
+        double salary;
+        double height;
+    };
+} // namespace hr
+
+using hr::Person;
+
+TEST_CASE("soa_vector - columns")
+{
+    static_assert(soa_details::member_count<Person>() == 4);
+    static_assert(soa_vector<Person>::index_of<&Person::salary> == 2);
+    static_assert(soa_vector<Person>::index_of<&Person::height> == 3);
+    static_assert(std::same_as<soa_vector<Person>::member_type<&Person::name>, std::string>);
+
+    soa_vector<Person> people{{1, "Kowalski", 10'000.0, 1.78}, {2, "Nowak", 8'000.0, 1.65}};
+    people.push_back({3, "Anonim", 12'000.0, 1.92});
+
+    REQUIRE(people.size() == 3);
+
+    std::span<double> salaries = people.column<&Person::salary>();
+    CHECK(std::accumulate(salaries.begin(), salaries.end(), 0.0) == 30'000.0);
+
+    for (double& salary : salaries)
+        salary *= 1.1; // raise for everyone - one contiguous array
+    CHECK(people[1].get<&Person::salary>() == 8'800.0);
+
+    const auto& const_people = people;
+    std::span<const std::string> names = const_people.column<&Person::name>();
+    CHECK(names.back() == "Anonim");
+}
+
+TEST_CASE("soa_vector - row proxies")
+{
+    soa_vector<Person> people;
+    people.push_back({42, "Kowalski", 10'000.0, 1.78});
+
+    Person p = people[0]; // gathered from all columns
+    CHECK(p.name == "Kowalski");
+    CHECK(p.height == 1.78);
+
+    people[0].get<&Person::name>() = "Nowak";
+    CHECK(people.column<&Person::name>()[0] == "Nowak");
+
+    people[0] = Person{665, "Anonim", 0.0, 2.01};
+    CHECK(people.get(0).id == 665);
+    CHECK(people.at(0).get<&Person::height>() == 2.01);
+    CHECK_THROWS_AS(people.at(1), std::out_of_range);
+}
+
+TEST_CASE("soa_vector - bulk append")
+{
+    std::vector<Person> rows;
+    for (int i = 0; i < 1000; ++i)
+        rows.push_back({i, "P" + std::to_string(i), 1000.0 + i, 1.5 + i * 0.0005});
+
+    soa_vector<Person> people;
+    people.push_back({-1, "first", 0.0, 0.0});
+    people.append(rows);
+
+    REQUIRE(people.size() == 1001);
+    CHECK(people.column<&Person::id>()[500] == 499);
+    CHECK(people.column<&Person::name>()[1000] == "P999");
+    CHECK(people.get(1).salary == 1000.0);
+
+    people.clear();
+    CHECK(people.empty());
+}
+
+namespace
+{
+    struct Task
+    {
+        int id;
+        bool done;
+    };
+
+    struct ThrowsOnCopy
+    {
+        bool fail = false;
+
+        ThrowsOnCopy() = default;
+
+        ThrowsOnCopy(bool fail)
+            : fail{fail}
+        {
+        }
+
+        ThrowsOnCopy(const ThrowsOnCopy& other)
+            : fail{other.fail}
+        {
+            if (fail)
+                throw std::runtime_error("copy failed");
+        }
+
+        ThrowsOnCopy& operator=(const ThrowsOnCopy&) = default;
+    };
+
+    struct Entry
+    {
+        int id;
+        std::string name;
+        ThrowsOnCopy payload;
+    };
+} // namespace
+
+TEST_CASE("soa_vector - bool members")
+{
+    static_assert(std::same_as<soa_vector<Task>::member_type<&Task::done>, bool>);
+
+    soa_vector<Task> tasks{{1, false}, {2, true}, {3, true}};
+
+    std::span<soa_details::Bool> done = tasks.column<&Task::done>(); // contiguous bytes, not vector<bool> bits
+    CHECK(std::count(done.begin(), done.end(), true) == 2);
+
+    tasks[0].get<&Task::done>() = true;
+    CHECK(tasks.get(0).done);
+
+    Task task = tasks[1];
+    CHECK(task.done);
+}
+
+TEST_CASE("soa_vector - failed insertion keeps columns equal in size")
+{
+    soa_vector<Entry> entries;
+    entries.push_back({1, "one", ThrowsOnCopy{}});
+
+    const Entry bad{2, "two", ThrowsOnCopy{true}};
+    CHECK_THROWS_AS(entries.push_back(bad), std::runtime_error); // id and name were pushed before payload threw
+
+    CHECK(entries.size() == 1);
+    CHECK(entries.column<&Entry::id>().size() == 1);
+    CHECK(entries.column<&Entry::name>().size() == 1);
+
+    const std::vector<Entry> rows{{3, "three", ThrowsOnCopy{}}, {4, "four", ThrowsOnCopy{}}, {5, "five", ThrowsOnCopy{}}};
+    std::vector<Entry> with_bad_row = rows;
+    with_bad_row[1].payload.fail = true;
+
+    CHECK_THROWS_AS(entries.append(with_bad_row), std::runtime_error);
+    CHECK(entries.column<&Entry::name>().size() == 1);
+    CHECK(entries.column<&Entry::payload>().size() == 1);
+
+    entries.append(rows);
+    CHECK(entries.size() == 4);
+    CHECK(entries.column<&Entry::name>().back() == "five");
+}
@@ -0,0 +1,182 @@
+#ifndef STATIC_MAP_HPP
+#define STATIC_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace static_map_details
+{
+    constexpr std::uint64_t fnv1a(std::string_view key)
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ULL;
+        for (char c : key)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    constexpr std::uint64_t mix(std::uint64_t hash, std::uint64_t seed)
+    {
+        hash ^= seed * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 31;
+        hash *= 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 29;
+        return hash;
+    }
+} // namespace static_map_details
+
+// Immutable string -> V map with a perfect hash built at compile time ("hash and displace"):
+// the key is hashed once, the bucket's displacement picks a collision-free slot, one compare confirms it.
+// The type is structural - a map can be passed as NTTP.
+template <typename V, size_t N, size_t MaxKeyLength = 15>
+struct StaticMap
+{
+    static_assert(N > 0);
+
+    static constexpr size_t table_size = std::bit_ceil(N);
+    static constexpr std::uint8_t empty_slot = 0xFF;
+    static_assert(MaxKeyLength < empty_slot);
+
+    using value_type = V;
+    using Key = std::array<char, MaxKeyLength>;
+
+    // displacement per bucket: >= 0 - seed for mix(), < 0 - direct slot index -(d + 1)
+    std::array<std::int32_t, N> displacements{};
+    std::array<Key, table_size> keys{};
+    std::array<std::uint8_t, table_size> key_lengths{};
+    std::array<V, table_size> values{};
+
+    consteval StaticMap(const std::pair<std::string_view, V> (&entries)[N])
+    {
+        key_lengths.fill(empty_slot);
+
+        std::array<std::array<size_t, N>, N> buckets{}; // entry indexes per bucket
+        std::array<size_t, N> bucket_sizes{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (entries[i].first.size() > MaxKeyLength)
+                throw std::length_error("key too long - increase MaxKeyLength");
+
+            for (size_t j = 0; j < i; ++j)
+                if (entries[i].first == entries[j].first)
+                    throw std::invalid_argument("duplicated key");
+
+            const size_t bucket = bucket_of(static_map_details::fnv1a(entries[i].first));
+            buckets[bucket][bucket_sizes[bucket]++] = i;
+        }
+
+        std::array<size_t, N> bucket_order{};
+        for (size_t i = 0; i < N; ++i)
+            bucket_order[i] = i;
+        std::ranges::sort(bucket_order, [&](size_t a, size_t b) { return bucket_sizes[a] > bucket_sizes[b]; });
+
+        for (size_t bucket : bucket_order)
+        {
+            const size_t size = bucket_sizes[bucket];
+            if (size == 0)
+                break;
+
+            if (size == 1) // no collision possible - take any free slot
+            {
+                const auto free_slot = std::ranges::find(key_lengths, empty_slot) - key_lengths.begin();
+                displacements[bucket] = -static_cast<std::int32_t>(free_slot) - 1;
+                store(free_slot, entries[buckets[bucket][0]]);
+                continue;
+            }
+
+            for (std::int32_t seed = 0;; ++seed)
+            {
+                std::array<size_t, N> slots{};
+                bool collision = false;
+                for (size_t i = 0; i < size && !collision; ++i)
+                {
+                    slots[i] = slot_of(static_map_details::fnv1a(entries[buckets[bucket][i]].first), seed);
+                    collision = key_lengths[slots[i]] != empty_slot || std::ranges::find(slots.begin(), slots.begin() + i, slots[i]) != slots.begin() + i;
+                }
+
+                if (!collision)
+                {
+                    displacements[bucket] = seed;
+                    for (size_t i = 0; i < size; ++i)
+                        store(slots[i], entries[buckets[bucket][i]]);
+                    break;
+                }
+            }
+        }
+    }
+
+    constexpr std::optional<V> find(std::string_view key) const
+    {
+        if (key.size() > MaxKeyLength) // also keeps empty slots (length 0xFF) from matching
+            return std::nullopt;
+
+        const size_t slot = slot_for(key);
+
+        if (key_lengths[slot] != key.size() || !std::ranges::equal(key, std::string_view{keys[slot].data(), key_lengths[slot]}))
+            return std::nullopt;
+
+        return values[slot];
+    }
+
+    constexpr bool contains(std::string_view key) const
+    {
+        return find(key).has_value();
+    }
+
+    constexpr V at(std::string_view key) const
+    {
+        if (auto value = find(key))
+            return *value;
+
+        throw std::out_of_range("key not found");
+    }
+
+    static constexpr size_t size()
+    {
+        return N;
+    }
+
+private:
+    static constexpr size_t bucket_of(std::uint64_t hash)
+    {
+        return (hash >> 32) % N;
+    }
+
+    static constexpr size_t slot_of(std::uint64_t hash, std::int32_t seed)
+    {
+        return static_map_details::mix(hash, seed) & (table_size - 1);
+    }
+
+    constexpr size_t slot_for(std::string_view key) const
+    {
+        const std::uint64_t hash = static_map_details::fnv1a(key);
+        const std::int32_t displacement = displacements[bucket_of(hash)];
+
+        return displacement < 0 ? static_cast<size_t>(-displacement - 1) : slot_of(hash, displacement);
+    }
+
+    constexpr void store(size_t slot, const std::pair<std::string_view, V>& entry)
+    {
+        std::ranges::copy(entry.first, keys[slot].begin());
+        key_lengths[slot] = static_cast<std::uint8_t>(entry.first.size());
+        values[slot] = entry.second;
+    }
+};
+
+// static_map<DayOfWeek>({{"mon", DayOfWeek::mon}, ...}) - size is deduced from the list
+template <typename V, size_t MaxKeyLength = 15, size_t N>
+consteval auto static_map(const std::pair<std::string_view, V> (&entries)[N])
+{
+    return StaticMap<V, N, MaxKeyLength>{entries};
+}
+
+#endif
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "static_map.hpp"
+
+using namespace std::literals;
+
+namespace
+{
+    enum class DayOfWeek { mon, tue, wed, thd, fri, sat, sun };
+
+    using enum DayOfWeek;
+
+    constexpr auto day_of_week = static_map<DayOfWeek>({{"mon", mon}, {"tue", tue}, {"wed", wed}, {"thd", thd}, {"fri", fri}, {"sat", sat}, {"sun", sun}});
+
+    template <StaticMap Names>
+    DayOfWeek parse(std::string_view text) // map as NTTP
+    {
+        return Names.at(text);
+    }
+} // namespace
+
+TEST_CASE("static_map - perfect hash")
+{
+    static_assert(day_of_week.size() == 7);
+    static_assert(day_of_week.find("wed") == wed);
+    static_assert(!day_of_week.contains("thu"));
+
+    std::string input = "sun";
+    CHECK(day_of_week.find(input) == sun);
+    CHECK(day_of_week.find("") == std::nullopt);
+    CHECK(day_of_week.find("sunday") == std::nullopt);
+    CHECK(day_of_week.find(std::string(255, 'x')) == std::nullopt); // longer than any key
+    static_assert(!day_of_week.contains(std::string_view{"abcdefghijklmnopqrstuvwxyz"}));
+
+    SECTION("NTTP")
+    {
+        CHECK(parse<day_of_week>("fri") == fri);
+        CHECK_THROWS_AS(parse<day_of_week>("friday"), std::out_of_range);
+    }
+}
+
+TEST_CASE("static_map - many keys")
+{
+    constexpr auto http_status = static_map<int, 24>({{"continue", 100}, {"ok", 200}, {"created", 201}, {"accepted", 202},
+        {"no_content", 204}, {"moved_permanently", 301}, {"found", 302}, {"not_modified", 304}, {"bad_request", 400},
+        {"unauthorized", 401}, {"forbidden", 403}, {"not_found", 404}, {"method_not_allowed", 405}, {"conflict", 409},
+        {"gone", 410}, {"teapot", 418}, {"too_many_requests", 429}, {"internal_error", 500}, {"not_implemented", 501},
+        {"bad_gateway", 502}, {"unavailable", 503}, {"gateway_timeout", 504}});
+
+    static_assert(http_status.size() == 22);
+    static_assert(http_status.table_size == 32);
+
+    CHECK(http_status.at("teapot") == 418);
+    CHECK(http_status.at("method_not_allowed") == 405);
+    CHECK(http_status.at("gateway_timeout") == 504);
+    CHECK_FALSE(http_status.contains("see_other"));
+
+    // static_map<int>({{"ok", 200}, {"ok", 201}}); // ERROR - duplicated key
+}
@@ -0,0 +1,116 @@
+#ifndef STATIC_SORT_HPP
+#define STATIC_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace static_sort_details
+{
+    struct Comparator
+    {
+        size_t first;
+        size_t second;
+
+        auto operator<=>(const Comparator&) const = default;
+    };
+
+    // Batcher's odd-even merge sort for the next power of two - comparators touching padding (+inf) are dropped
+    template <typename TVisitor>
+    constexpr void batcher_network(size_t n, TVisitor visitor)
+    {
+        const size_t padded_n = std::bit_ceil(n);
+
+        for (size_t p = 1; p < padded_n; p *= 2)
+            for (size_t k = p; k >= 1; k /= 2)
+                for (size_t j = k % p; j + k < padded_n; j += 2 * k)
+                    for (size_t i = 0; i < std::min(k, padded_n - j - k); ++i)
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < n)
+                            visitor(Comparator{i + j, i + j + k});
+    }
+
+    template <size_t N>
+    inline constexpr size_t network_size = [] {
+        size_t count = 0;
+        batcher_network(N, [&](Comparator) { ++count; });
+        return count;
+    }();
+
+    template <size_t N>
+    inline constexpr auto network = [] {
+        std::array<Comparator, network_size<N>> comparators{};
+        size_t index = 0;
+        batcher_network(N, [&](Comparator c) { comparators[index++] = c; });
+        return comparators;
+    }();
+
+    template <size_t First, size_t Second, typename T, typename TCompare>
+    constexpr void compare_exchange(T* data, TCompare& comp)
+    {
+        // written as two selects - compiles to min/max (cmov, vpminsd) instead of a branch
+        const T a = data[First];
+        const T b = data[Second];
+        const bool swap = comp(b, a);
+        data[First] = swap ? b : a;
+        data[Second] = swap ? a : b;
+    }
+
+    template <size_t N, typename T, typename TCompare, size_t... Is>
+    constexpr void apply_network(T* data, TCompare& comp, std::index_sequence<Is...>)
+    {
+        (compare_exchange<network<N>[Is].first, network<N>[Is].second>(data, comp), ...);
+    }
+} // namespace static_sort_details
+
+// sorting network generated at compile time and fully unrolled - no branches on the data
+template <size_t N, typename T, typename TCompare = std::ranges::less>
+constexpr void static_sort(std::span<T, N> data, TCompare comp = {})
+{
+    if constexpr (N > 1)
+        static_sort_details::apply_network<N>(data.data(), comp, std::make_index_sequence<static_sort_details::network_size<N>>{});
+}
+
+template <typename T, size_t N, typename TCompare = std::ranges::less>
+constexpr void static_sort(std::array<T, N>& data, TCompare comp = {})
+{
+    static_sort(std::span<T, N>{data}, comp);
+}
+
+// merge sort with static_sort<BlockSize> as the base case
+template <size_t BlockSize = 16, typename T, typename TCompare = std::ranges::less>
+void network_merge_sort(std::span<T> data, TCompare comp = {})
+{
+    size_t pos = 0;
+    for (; pos + BlockSize <= data.size(); pos += BlockSize)
+        static_sort(data.subspan(pos).template first<BlockSize>(), comp);
+    std::sort(data.begin() + pos, data.end(), comp);
+
+    if (data.size() <= BlockSize)
+        return;
+
+    std::vector<T> buffer(data.size());
+    std::span<T> source = data;
+    std::span<T> destination = buffer;
+
+    for (size_t width = BlockSize; width < data.size(); width *= 2)
+    {
+        for (size_t first = 0; first < data.size(); first += 2 * width)
+        {
+            const size_t middle = std::min(first + width, data.size());
+            const size_t last = std::min(first + 2 * width, data.size());
+            std::merge(source.begin() + first, source.begin() + middle, source.begin() + middle, source.begin() + last,
+                destination.begin() + first, comp);
+        }
+        std::swap(source, destination);
+    }
+
+    if (source.data() != data.data())
+        std::ranges::copy(source, data.begin());
+}
+
+#endif
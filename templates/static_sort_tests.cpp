@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "static_sort.hpp"
+
+namespace
+{
+    // 0-1 principle: a network sorting every sequence of 0s and 1s sorts every sequence
+    template <size_t N>
+    bool sorts_all_binary_sequences()
+    {
+        for (unsigned long bits = 0; bits < (1ul << N); ++bits)
+        {
+            std::array<int, N> data{};
+            for (size_t i = 0; i < N; ++i)
+                data[i] = (bits >> i) & 1;
+
+            static_sort(data);
+
+            if (!std::ranges::is_sorted(data))
+                return false;
+        }
+        return true;
+    }
+
+    template <size_t N>
+    bool sorts_random_sequences(std::mt19937& rnd)
+    {
+        for (int repeat = 0; repeat < 100; ++repeat)
+        {
+            std::array<int, N> data{};
+            std::ranges::generate(data, [&] { return static_cast<int>(rnd() % 50); });
+
+            auto expected = data;
+            std::ranges::sort(expected);
+
+            static_sort(data);
+
+            if (data != expected)
+                return false;
+        }
+        return true;
+    }
+} // namespace
+
+TEST_CASE("static_sort - sorting network")
+{
+    SECTION("is generated at compile time")
+    {
+        static_assert(static_sort_details::network_size<2> == 1);
+        static_assert(static_sort_details::network_size<4> == 5);
+        static_assert(static_sort_details::network_size<8> == 19);
+        static_assert(static_sort_details::network_size<16> == 63);
+
+        static_assert(std::ranges::all_of(static_sort_details::network<13>, [](auto c) { return c.first < c.second && c.second < 13; }));
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr auto sorted = [] {
+            std::array data{5, 3, 8, 1, 9, 2, 7};
+            static_sort(data);
+            return data;
+        }();
+
+        static_assert(sorted == std::array{1, 2, 3, 5, 7, 8, 9});
+    }
+
+    SECTION("sorts every input - N <= 16")
+    {
+        const bool all_sorted = []<size_t... Ns>(std::index_sequence<Ns...>) {
+            return (sorts_all_binary_sequences<Ns>() && ...);
+        }(std::make_index_sequence<17>{});
+
+        CHECK(all_sorted);
+    }
+
+    SECTION("sorts random input - N <= 64")
+    {
+        std::mt19937 rnd{665};
+
+        const bool all_sorted = [&]<size_t... Ns>(std::index_sequence<Ns...>) {
+            return (sorts_random_sequences<Ns + 17>(rnd) && ...);
+        }(std::make_index_sequence<48>{});
+
+        CHECK(all_sorted);
+    }
+
+    SECTION("custom comparer")
+    {
+        std::array<std::string, 5> words = {"one", "three", "four", "two", "five"};
+        static_sort(words, std::greater{});
+
+        CHECK(words == std::array<std::string, 5>{"two", "three", "one", "four", "five"});
+    }
+}
+
+TEST_CASE("network_merge_sort - static_sort as base case")
+{
+    std::mt19937 rnd{42};
+
+    for (size_t size : {0u, 1u, 15u, 16u, 17u, 100u, 1000u, 4099u})
+    {
+        std::vector<int> data(size);
+        std::ranges::generate(data, [&] { return static_cast<int>(rnd() % 1000) - 500; });
+
+        auto expected = data;
+        std::ranges::sort(expected);
+
+        network_merge_sort(std::span{data});
+
+        CHECK(data == expected);
+    }
+}
@@ -1,12 +1,18 @@
 #include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <fill.hpp>
 #include <iostream>
 #include <memory>
 #include <numeric>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "logger.hpp"
+#include "money.hpp"
+#include "thread_pool.hpp"
+
 using namespace std::literals;
 
 auto fun_cpp20(auto a, auto b)
@@ -102,13 +108,6 @@ TEST_CASE("default construction for lambda")
     }
 }
 
-auto create_caller(auto f, auto... args)
-{
-    return [f, ... args = std::move(args)]() -> decltype(auto) {
-        return f(args...);
-    };
-};
-
 TEST_CASE("lambda - capture parameter pack")
 {
     auto calulate = create_caller(std::plus{}, 4, 6);
@@ -166,8 +165,7 @@ template <typename T, size_t N>
     requires PowerOf2<N>
 void zero(std::array<T, N>& arr)
 {
-    for (auto& item : arr)
-        item = T{};
+    helpers::fill(std::span<T>{arr}, T{});
 }
 
 TEST_CASE("NTTP + concepts")
@@ -203,17 +201,6 @@ TEST_CASE("NTTP + double, float")
 
 //////////////////////////////////////////////////
 
-struct Tax
-{
-    double value;
-
-    constexpr Tax(double v)
-        : value{v}
-    {
-        assert(value >= 0 && v < 1);
-    }
-};
-
 template <Tax Vat> // struct as NTTP
 double calc_gross_price(double net_price)
 {
@@ -254,35 +241,6 @@ TEST_CASE("NTTP + struct")
     CHECK(SinceCpp20::poly_calculate<linear_f>(1.0) == 2.0);
 }
 
-template <size_t N>
-struct Str
-{
-    char value[N];
-
-    constexpr Str(const char (&str)[N])
-    {
-        std::copy(str, str + N, value);
-    }
-
-    friend std::ostream& operator<<(std::ostream& out, const Str& str)
-    {
-        out << str.value;
-
-        return out;
-    }
-
-    auto operator<=>(const Str& other) const = default; // implicitly constexpr
-};
-
-template <Str LogPrefix>
-struct Logger
-{
-    void log(std::string_view msg)
-    {
-        std::cout << LogPrefix << msg << "\n";
-    }
-};
-
 TEST_CASE("NTTP + strings")
 {
     constexpr Str txt1{"text"};
@@ -295,6 +253,8 @@ TEST_CASE("NTTP + strings")
 
     Logger<"log: "> my_logger_2;
     my_logger_2.log("End");
+
+    logging::flush();
 }
 
 template <std::invocable auto GetVat>
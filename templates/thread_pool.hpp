@@ -0,0 +1,133 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "inplace_function.hpp"
+
+// callable with arguments captured by move - f(args...) is called later
+auto create_caller(auto f, auto... args)
+{
+    return [f, ... args = std::move(args)]() -> decltype(auto) {
+        return f(args...);
+    };
+}
+
+// Fixed pool of workers fed from a bounded ring of tasks. All slots are allocated up front and tasks are
+// moved in and out of them, so with Task = inplace_function<void()> submitting a job does not allocate.
+// submit() blocks while the queue is full, jobs must not throw. The destructor runs the jobs already queued, then joins the workers.
+// thread_count and queue_capacity must be positive - the constructor throws std::invalid_argument otherwise.
+template <typename Task = inplace_function<void()>>
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t thread_count = std::max(1u, std::thread::hardware_concurrency()), size_t queue_capacity = 1024)
+        : tasks_(queue_capacity)
+    {
+        if (thread_count == 0)
+            throw std::invalid_argument("thread pool needs at least one thread");
+        if (queue_capacity == 0)
+            throw std::invalid_argument("thread pool queue capacity must be positive");
+
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+            workers_.emplace_back([this] { run(); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::scoped_lock lk{mtx_};
+            stopping_ = true;
+        }
+        not_empty_.notify_all();
+    }
+
+    template <typename F>
+    void submit(F&& f)
+    {
+        {
+            std::unique_lock lk{mtx_};
+            not_full_.wait(lk, [this] { return count_ < tasks_.size(); });
+
+            tasks_[(head_ + count_) % tasks_.size()] = Task(std::forward<F>(f));
+            ++count_;
+        }
+        not_empty_.notify_one();
+    }
+
+    // submit(create_caller(f, args...))
+    template <typename F, typename Arg, typename... Args>
+    void submit(F f, Arg arg, Args... args)
+    {
+        submit(create_caller(std::move(f), std::move(arg), std::move(args)...));
+    }
+
+    // blocks until every submitted job has finished
+    void wait_idle()
+    {
+        std::unique_lock lk{mtx_};
+        idle_.wait(lk, [this] { return count_ == 0 && busy_ == 0; });
+    }
+
+    size_t size() const noexcept
+    {
+        return workers_.size();
+    }
+
+private:
+    std::vector<Task> tasks_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    size_t busy_ = 0;
+    bool stopping_ = false;
+
+    std::mutex mtx_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::condition_variable idle_;
+
+    std::vector<std::jthread> workers_; // last - joined before the queue is destroyed
+
+    void run()
+    {
+        while (true)
+        {
+            Task task;
+            {
+                std::unique_lock lk{mtx_};
+                not_empty_.wait(lk, [this] { return count_ > 0 || stopping_; });
+                if (count_ == 0)
+                    return;
+
+                task = std::move(tasks_[head_]);
+                head_ = (head_ + 1) % tasks_.size();
+                --count_;
+                ++busy_;
+            }
+            not_full_.notify_one();
+
+            task();
+            task = nullptr;
+
+            {
+                std::scoped_lock lk{mtx_};
+                --busy_;
+                if (count_ == 0 && busy_ == 0)
+                    idle_.notify_all();
+            }
+        }
+    }
+};
+
+#endif
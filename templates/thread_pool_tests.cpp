@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+namespace
+{
+    std::atomic<size_t> allocation_count{0};
+}
+
+// counting global allocator - the pool must not allocate per submitted job
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+TEST_CASE("ThreadPool - runs all jobs")
+{
+    std::vector<long> results(1000);
+    {
+        ThreadPool pool{4, 64}; // queue smaller than the number of jobs - submit() waits for the workers
+
+        for (size_t i = 0; i < results.size(); ++i)
+            pool.submit([&results, i] { results[i] = static_cast<long>(i) * 2; });
+    } // destructor finishes the queued jobs
+
+    CHECK(std::accumulate(results.begin(), results.end(), 0L) == 999 * 1000);
+}
+
+TEST_CASE("ThreadPool - zero threads or zero queue capacity is rejected")
+{
+    using Pool = ThreadPool<>;
+
+    CHECK_THROWS_AS(Pool(0, 16), std::invalid_argument);
+    CHECK_THROWS_AS(Pool(2, 0), std::invalid_argument);
+}
+
+TEST_CASE("ThreadPool - create_caller with move-only arguments")
+{
+    ThreadPool pool{2};
+
+    std::atomic<int> sum{0};
+    auto add = [&sum](const std::unique_ptr<int>& value, int factor) { sum += *value * factor; };
+
+    pool.submit(create_caller(add, std::make_unique<int>(10), 2));
+    pool.submit(add, std::make_unique<int>(5), 3); // the same through submit(f, args...)
+    pool.wait_idle();
+
+    CHECK(sum == 35);
+}
+
+TEST_CASE("ThreadPool - zero allocations per job")
+{
+    ThreadPool pool{2, 256};
+    std::vector<double> results(10'000);
+    pool.wait_idle();
+
+    const size_t allocations_before = allocation_count.load();
+
+    for (size_t i = 0; i < results.size(); ++i)
+        pool.submit([&results, i, a = 1.5, b = 2.5, c = 3.5] { results[i] = a * b + c * static_cast<double>(i); });
+    pool.wait_idle();
+
+    CHECK(allocation_count.load() == allocations_before);
+    CHECK(results[100] == 1.5 * 2.5 + 3.5 * 100);
+
+    SECTION("std::function allocates for the same captures")
+    {
+        ThreadPool<std::function<void()>> std_function_pool{2, 256};
+        std_function_pool.wait_idle();
+
+        const size_t std_function_before = allocation_count.load();
+        for (size_t i = 0; i < 100; ++i)
+            std_function_pool.submit([&results, i, a = 1.5, b = 2.5, c = 3.5] { results[i] = a * b + c; });
+        std_function_pool.wait_idle();
+
+        CHECK(allocation_count.load() - std_function_before >= 100);
+    }
+}